@@ -1,16 +1,28 @@
-from core import Policy
+from core import Policy, AlphaZeroPolicy
 from .mcts import MCTSAgent
 
 
-def PyConvNetAgent(network, c_puct, **constraint):
+def PyConvNetAgent(network, c_puct, c_batch=16, cache=None, **constraint):
+    # Leaves are collected into batches so that one forward pass evaluates up to c_batch states
+    # An EvaluationCache keeps repeated and symmetric positions away from the network
+    eval_state, eval_batch = network.eval_state, network.eval_batch
+    if cache is not None:
+        eval_state, eval_batch = cache.wrap(eval_state), cache.wrap_batch(eval_batch)
     return MCTSAgent(
-        policy=Policy(eval_state=network.eval_state, c_puct=c_puct),
+        policy=Policy(
+            eval_state=eval_state, eval_batch=eval_batch,
+            c_puct=c_puct, c_batch=c_batch
+        ),
         **constraint
     )
 
 
-def AlphaZeroAgent(**constraint):
-    pass
+def AlphaZeroAgent(model_file, c_puct, c_batch=16, **constraint):
+    # Native inference on weights exported by PolicyValueNetwork.export_native, no Python in the search loop
+    return MCTSAgent(
+        policy=AlphaZeroPolicy(model_file, c_puct=c_puct, c_batch=c_batch),
+        **constraint
+    )
 
 
 def main():
@@ -0,0 +1,104 @@
+#include "corpus.h"
+#include <vector>
+
+using namespace Gomoku;
+using namespace Gomoku::Bench;
+
+// 该局面下所有可行的落点
+static std::vector<Position> LegalMoves(const Board& board) {
+    std::vector<Position> moves;
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        if (board.checkMove(i)) {
+            moves.push_back(i);
+        }
+    }
+    return moves;
+}
+
+// 轮流在各空位上落子并悔棋，不检查胜负
+static void BM_BoardApplyRevert(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    auto moves = LegalMoves(board);
+    size_t i = 0;
+    for (auto _ : state) {
+        board.applyMove(moves[i], false);
+        board.revertMove();
+        i = (i + 1) % moves.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardApplyRevert)->Apply(StageArguments);
+
+// 同上，但在落子后检查胜负。与BM_BoardApplyRevert之差即为checkGameEnd的开销
+static void BM_BoardCheckGameEnd(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    auto moves = LegalMoves(board);
+    size_t i = 0;
+    for (auto _ : state) {
+        board.applyMove(moves[i], false);
+        benchmark::DoNotOptimize(board.checkGameEnd());
+        board.revertMove();
+        i = (i + 1) % moves.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardCheckGameEnd)->Apply(StageArguments);
+
+static void BM_BoardRandomMove(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(board.getRandomMove());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardRandomMove)->Apply(StageArguments);
+
+// 随机下完整盘棋后悔回原局面，即PoolRAVEPolicy的模拟过程
+static void BM_BoardRandomRollout(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    size_t moves = 0;
+    for (auto _ : state) {
+        size_t count = 0;
+        while (board.m_curPlayer != Player::None) {
+            board.applyMove(board.getRandomMove());
+            ++count;
+        }
+        board.revertMove(count);
+        moves += count;
+    }
+    state.SetItemsProcessed(moves);
+}
+BENCHMARK(BM_BoardRandomRollout)->Apply(StageArguments);
+
+// 同上，但在一次性的RolloutBoard上模拟，即RandomPolicy的模拟过程
+static void BM_LightRollout(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    size_t moves = 0;
+    for (auto _ : state) {
+        auto [winner, count] = RolloutBoard(board).play(RandomEngine::Local());
+        benchmark::DoNotOptimize(winner);
+        moves += count;
+    }
+    state.SetItemsProcessed(moves);
+}
+BENCHMARK(BM_LightRollout)->Apply(StageArguments);
+
+// 逐局从Board复制后模拟，与PlayMany成批模拟的对照，以每秒完成的模拟局数计
+template <bool Batched>
+static void BM_LightRollouts(benchmark::State& state) {
+    constexpr int C_ROLLOUTS = 8;
+    Board board = MakePosition(StageOf(state));
+    auto& engine = RandomEngine::Local();
+    for (auto _ : state) {
+        if constexpr (Batched) {
+            benchmark::DoNotOptimize(RolloutBoard::PlayMany(board, C_ROLLOUTS, engine));
+        } else {
+            for (int i = 0; i < C_ROLLOUTS; ++i) {
+                benchmark::DoNotOptimize(RolloutBoard(board).play(engine));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * C_ROLLOUTS);
+}
+BENCHMARK_TEMPLATE(BM_LightRollouts, false)->Apply(StageArguments);
+BENCHMARK_TEMPLATE(BM_LightRollouts, true)->Apply(StageArguments);
@@ -0,0 +1,57 @@
+//
+// corpus.h
+// Fixed positions shared by all benchmarks.
+//
+
+#pragma once
+#include "lib/include/Game.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string_view>
+
+namespace Gomoku::Bench {
+
+// 基准测试所用的局面：开局、中局、残局
+enum Stage { Opening, Midgame, Endgame, StageSize };
+
+constexpr std::array<std::string_view, StageSize> StageNames = { "opening", "midgame", "endgame" };
+
+// 各阶段的落子数，按棋盘大小折算（15路棋盘上为4、40、120手）
+constexpr std::array<int, StageSize> StageMoves = { 4, BOARD_SIZE * 2 / 11, BOARD_SIZE * 8 / 15 };
+
+// 由固定种子生成的局面：在空位中伪随机落子，并跳过会使游戏结束的手，保证每次构建得到相同的局面。
+inline Board MakePosition(Stage stage) {
+    RandomEngine engine(2018 + stage);
+    Board board;
+    if (stage == Opening) { // 开局集中在天元附近
+        const int x = WIDTH / 2, y = HEIGHT / 2;
+        for (Position move : { Position{ x, y }, Position{ x + 1, y + 1 }, Position{ x, y + 1 }, Position{ x + 1, y } }) {
+            board.applyMove(move);
+        }
+        return board;
+    }
+    while (board.m_moveRecord.size() < StageMoves[stage]) {
+        Position move = engine.below(BOARD_SIZE);
+        if (!board.checkMove(move)) {
+            continue;
+        }
+        if (board.applyMove(move) == Player::None) {
+            board.revertMove();
+        }
+    }
+    return board;
+}
+
+// 以局面阶段为参数注册基准测试，并以阶段名作为标签
+inline void StageArguments(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("stage");
+    for (int stage = 0; stage < StageSize; ++stage) {
+        bench->Arg(stage);
+    }
+}
+
+inline Stage StageOf(const benchmark::State& state) {
+    return static_cast<Stage>(state.range(0));
+}
+
+}
@@ -0,0 +1,95 @@
+#include "corpus.h"
+#include "lib/include/MCTS.h"
+#include "lib/include/policies/Random.h"
+#include "lib/include/policies/PoolRAVE.h"
+#include "lib/include/policies/Traditional.h"
+#include <memory>
+
+using namespace Gomoku;
+using namespace Gomoku::Bench;
+using namespace Gomoku::Policies;
+
+// 每轮计时所做的Playout数
+constexpr size_t C_PLAYOUTS = 200;
+
+// 每轮在同一局面上新建一棵树，完成C_PLAYOUTS次迭代后不计时地销毁，并记录每次Playout平均创建的结点数。
+template <typename Policy_t>
+static void RunPlayouts(benchmark::State& state, double c_widening) {
+    Board board = MakePosition(StageOf(state));
+    size_t nodes = 0;
+    for (auto _ : state) {
+        auto policy = std::make_shared<Policy_t>();
+        policy->c_widening = c_widening;
+        auto mcts = std::make_unique<MCTS>(C_PLAYOUTS, -1, Player::White, policy);
+        benchmark::DoNotOptimize(mcts->getAction(board));
+        state.PauseTiming();
+        nodes += mcts->m_size;
+        mcts.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * C_PLAYOUTS);
+    state.counters["nodes"] = benchmark::Counter(double(nodes) / (state.iterations() * C_PLAYOUTS));
+}
+
+// 统计各策略每秒完成的Playout数
+template <typename Policy_t>
+static void BM_Playouts(benchmark::State& state) {
+    RunPlayouts<Policy_t>(state, C_WIDENING);
+}
+BENCHMARK_TEMPLATE(BM_Playouts, RandomPolicy)->Apply(StageArguments)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Playouts, PoolRAVEPolicy)->Apply(StageArguments)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Playouts, TraditionalPolicy)->Apply(StageArguments)->Unit(benchmark::kMillisecond);
+
+// 同上，但启用逐步展开
+template <typename Policy_t>
+static void BM_WidenedPlayouts(benchmark::State& state) {
+    RunPlayouts<Policy_t>(state, 1.0);
+}
+BENCHMARK_TEMPLATE(BM_WidenedPlayouts, RandomPolicy)->Apply(StageArguments)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_WidenedPlayouts, PoolRAVEPolicy)->Apply(StageArguments)->Unit(benchmark::kMillisecond);
+
+// 统计销毁整棵树的开销，以每秒销毁的结点数计
+static void BM_TreeTeardown(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    size_t nodes = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto mcts = std::make_unique<MCTS>(size_t(C_PLAYOUTS * 10), -1, Player::White, std::make_shared<RandomPolicy>());
+        mcts->getAction(board);
+        nodes += mcts->m_size;
+        state.ResumeTiming();
+        mcts.reset();
+    }
+    state.SetItemsProcessed(nodes);
+}
+BENCHMARK(BM_TreeTeardown)->Apply(StageArguments)->Unit(benchmark::kMicrosecond);
+
+// 统计推进根结点的开销，以每秒丢弃的结点数计。启用异步回收时，只计入将子树提交给回收线程的开销。
+// 建树的开销远大于计时部分，故固定迭代次数
+template <bool Async>
+static void BM_RootAdvance(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    size_t nodes = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto mcts = std::make_unique<MCTS>(size_t(C_PLAYOUTS * 10), -1, Player::White, std::make_shared<RandomPolicy>());
+        mcts->c_asyncReclaim = Async;
+        mcts->getAction(board);
+        if (mcts->m_reclaimer) {
+            mcts->m_reclaimer->wait();
+        }
+        nodes += mcts->m_size;
+        state.ResumeTiming();
+        mcts->stepForward();
+        state.PauseTiming();
+        if (mcts->m_reclaimer) {
+            mcts->m_reclaimer->wait();
+        }
+        nodes -= mcts->m_pool->size();
+        mcts.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(nodes);
+}
+BENCHMARK_TEMPLATE(BM_RootAdvance, false)->Apply(StageArguments)->Iterations(50)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_RootAdvance, true)->Apply(StageArguments)->Iterations(50)->Unit(benchmark::kMicrosecond);
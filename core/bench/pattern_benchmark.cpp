@@ -0,0 +1,150 @@
+#include "corpus.h"
+#include "lib/include/Pattern.h"
+#include "lib/include/algorithms/Heuristic.hpp"
+#include "lib/include/algorithms/Threat.hpp"
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Gomoku;
+using namespace Gomoku::Bench;
+
+// 在Evaluator上轮流落子并悔棋，即TraditionalPolicy每一步选择所做的增量更新
+template <bool Checked>
+static void BM_EvaluatorApplyRevert(benchmark::State& state) {
+    const bool checked = std::exchange(Evaluator::Checked, Checked);
+    Board board = MakePosition(StageOf(state));
+    Evaluator ev;
+    ev.syncWithBoard(board);
+    std::vector<Position> moves;
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        if (board.checkMove(i)) {
+            moves.push_back(i);
+        }
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        ev.applyMove(moves[i]);
+        ev.revertMove();
+        i = (i + 1) % moves.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    Evaluator::Checked = checked;
+}
+// 两者之差即为一致性检查的开销
+BENCHMARK_TEMPLATE(BM_EvaluatorApplyRevert, false)->Apply(StageArguments);
+BENCHMARK_TEMPLATE(BM_EvaluatorApplyRevert, true)->Apply(StageArguments);
+
+// 从空盘逐手重放至该局面，即没有快照时重建评估器状态的开销
+static void BM_EvaluatorReplay(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    Evaluator ev;
+    for (auto _ : state) {
+        ev.reset();
+        ev.syncWithBoard(board);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EvaluatorReplay)->Apply(StageArguments);
+
+// 从快照恢复该局面，开销与手数无关
+static void BM_EvaluatorRestore(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    Evaluator ev;
+    Evaluator::Snapshot snapshot;
+    ev.syncWithBoard(board);
+    ev.save(snapshot);
+    for (auto _ : state) {
+        ev.restore(snapshot);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EvaluatorRestore)->Apply(StageArguments);
+
+// 落子后按评估概率筛选决定性落点，即TraditionalPolicy每次模拟的一步
+static void BM_HeuristicDecisiveFilter(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    Evaluator ev;
+    ev.syncWithBoard(board);
+    std::vector<Position> moves;
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        if (board.checkMove(i)) {
+            moves.push_back(i);
+        }
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        ev.applyMove(moves[i]);
+        Eigen::VectorXf probs = Algorithms::Heuristic::EvaluationProbs(ev, ev.board().m_curPlayer);
+        benchmark::DoNotOptimize(Algorithms::Heuristic::DecisiveFilter(ev, probs));
+        ev.revertMove();
+        i = (i + 1) % moves.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HeuristicDecisiveFilter)->Apply(StageArguments);
+
+// 以默认预算在局面上求解VCF，即TraditionalPolicy每回合在根局面上的搜索。每轮先清空置换表（不计时）
+static void BM_ThreatSolve(benchmark::State& state) {
+    Board board = MakePosition(StageOf(state));
+    Evaluator ev;
+    ev.syncWithBoard(board);
+    Algorithms::ThreatSolver solver;
+    size_t nodes = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        solver.clear();
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(solver.solve(ev, C_VCF_NODES));
+        nodes += solver.m_nodes;
+    }
+    state.SetItemsProcessed(nodes);
+    state.counters["nodes"] = benchmark::Counter(double(nodes) / state.iterations());
+}
+BENCHMARK(BM_ThreatSolve)->Apply(StageArguments)->Unit(benchmark::kMicrosecond);
+
+// 局面上所有已落子点的四个方向的线视图
+static std::vector<std::string> LineViews(Stage stage) {
+    Board board = MakePosition(stage);
+    BoardMap map; // BoardMap拥有并重置传入的Board，因此在其内部棋盘上重放棋谱
+    for (auto move : board.m_moveRecord) {
+        map.applyMove(move);
+    }
+    std::vector<std::string> lines;
+    for (auto move : board.m_moveRecord) {
+        for (auto dir : Directions) {
+            lines.emplace_back(map.lineView(move, dir));
+        }
+    }
+    return lines;
+}
+
+// 用AC自动机对线视图做完整的模式匹配
+static void BM_PatternSearchMatches(benchmark::State& state) {
+    auto lines = LineViews(StageOf(state));
+    size_t i = 0, matches = 0;
+    for (auto _ : state) {
+        matches += Evaluator::Patterns.matches(lines[i]).size();
+        i = (i + 1) % lines.size();
+    }
+    benchmark::DoNotOptimize(matches);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PatternSearchMatches)->Apply(StageArguments);
+
+// 查表求出线视图上覆盖中心点的模式，即Evaluator每次增量更新所做的匹配
+static void BM_PatternSearchLookup(benchmark::State& state) {
+    auto lines = LineViews(StageOf(state));
+    PatternSearch::Entries entries;
+    size_t i = 0, matches = 0;
+    for (auto _ : state) {
+        entries.clear();
+        Evaluator::Patterns.lookup(lines[i], entries);
+        matches += entries.size();
+        i = (i + 1) % lines.size();
+    }
+    benchmark::DoNotOptimize(matches);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PatternSearchLookup)->Apply(StageArguments);
@@ -5,6 +5,8 @@
 #include <nlohmann/json.hpp>
 #include "Game.h"
 #include "MCTS.h"
+#include "AlphaBeta.h"
+#include "OpeningBook.h"
 #include "Pattern.h"
 #include "algorithms/Heuristic.hpp"
 
@@ -18,14 +20,22 @@ namespace Interface {
 
 class Agent {
 public:
+    virtual ~Agent() = default; // 评测时经由基类指针销毁
+
     virtual std::string name() = 0;
 
     virtual Position getAction(Board& board) = 0;
 
     virtual json debugMessage() { return json(); };
 
+    // 上一次getAction所做的Playout数，不进行蒙特卡洛树搜索的Agent为0。用于评测时比较搜索的吞吐量
+    virtual size_t playouts() { return 0; }
+
     virtual void syncWithBoard(Board& board) { };
 
+    // 在等待对手落子期间利用空闲时间思考（可选）。下一次调用syncWithBoard时结束。
+    virtual void ponder(Board&) { }
+
     virtual void reset() { }
 };
 
@@ -61,7 +71,13 @@ public:
 
 class MCTSAgent : public Agent {
 public:
-    MCTSAgent(milliseconds durations, Policy* policy) : c_duration(durations), m_policy(policy) { }
+    // Botzone上的内存上限为256MB，树的上限需为评估器等其余部分留出余量
+    static constexpr size_t C_MEMORY_LIMIT = 192 << 20;
+
+    // 传入timer时按整局的总时长分配每步的搜索时间，durations仅作为未启用时的固定时长
+    MCTSAgent(milliseconds durations, Policy* policy, size_t memory_limit = C_MEMORY_LIMIT, 
+              std::shared_ptr<TimeManager> timer = nullptr) 
+        : m_policy(policy), c_duration(durations), c_memoryLimit(memory_limit), m_timer(std::move(timer)) { }
 
     virtual std::string name() {
         using namespace std::chrono;
@@ -69,9 +85,15 @@ public:
     }
 
     virtual Position getAction(Board& board) {
+        m_bookMove = m_book ? m_book->lookup(board) : Position::npos;
+        if (m_bookMove != Position::npos) { // 开局库命中时无需搜索，树在下一次同步时随之推进
+            return m_bookMove;
+        }
         auto [state_value, action_probs] = m_mcts->evalState(board);
-        Eigen::Map<const Eigen::Array<float, 15, 15, Eigen::RowMajor>> probs_2d(action_probs.data());
-        std::cout << state_value << std::endl;
+        Eigen::Map<const Eigen::Array<float, HEIGHT, WIDTH, Eigen::RowMajor>> probs_2d(action_probs.data());
+        if (c_verbose) {
+            std::cout << state_value << std::endl;
+        }
         //std::cout << probs_2d << std::endl;
         Position next_move;
         action_probs.maxCoeff(&next_move.id);
@@ -79,29 +101,113 @@ public:
     }
 
     virtual json debugMessage() {
-        return {
+        if (m_bookMove != Position::npos) {
+            return { { "book", true } };
+        }
+        json message = {
             { "iterations", m_mcts->m_iterations },
-            { "duration",   std::to_string(m_mcts->m_duration.count()) + "ms" }
+            { "duration",   std::to_string(m_mcts->m_duration.count()) + "ms" },
+            { "pondered",   m_mcts->m_ponderIterations },
+            { "nodes",      m_mcts->m_size },
+            { "memory",     std::to_string(m_mcts->m_memory >> 20) + "MB" }
         };
+        const auto& stats = m_mcts->m_stats;
+        static constexpr const char* phases[SearchStats::Phases] = { "select", "simulate", "expand", "backprop" };
+        for (int i = 0; i < SearchStats::Phases; ++i) {
+            message["phases"][phases[i]]["calls"] = stats.calls[i];
+            if (c_profile) {
+                message["phases"][phases[i]]["time"] = std::to_string(std::chrono::duration_cast<milliseconds>(stats.time[i]).count()) + "ms";
+            }
+        }
+        message["allocated"] = stats.nodes;
+        message["depth"] = { { "max", stats.maxDepth }, { "average", stats.averageDepth() } };
+        message["branching"] = stats.branching();
+        message["evaluator"] = { { "applies", stats.applies }, { "reverts", stats.reverts }, { "hit_ratio", stats.hitRatio() } };
+        if (m_timer) {
+            message["duration"] = std::to_string(m_timer->m_spent.count()) + "ms";
+            message["remaining"] = std::to_string(m_timer->m_remaining.count()) + "ms";
+            message["stopped_early"] = m_timer->m_stoppedEarly;
+            message["extended"] = m_timer->m_extended;
+        }
+        return message;
     };
 
+    virtual size_t playouts() {
+        return m_bookMove != Position::npos || m_mcts == nullptr ? 0 : m_mcts->m_iterations;
+    }
+
     virtual void syncWithBoard(Board& board) {
         if (m_mcts == nullptr) {
             auto last_action = board.m_moveRecord.empty() ? Position(-1) : board.m_moveRecord.back();
             m_mcts = std::make_unique<MCTS>(c_duration, last_action, -board.m_curPlayer, m_policy);
+            m_mcts->c_memoryLimit = c_memoryLimit;
+            m_mcts->c_asyncReclaim = true; // 丢弃的子树在后台销毁，不占用落子的时间
+            m_mcts->c_historyDepth = C_HISTORY_DEPTH; // 悔棋时退回保留的祖先，不必重新搜索
+            m_mcts->m_timer = m_timer;
         } else {
             m_mcts->syncWithBoard(board);
         }
+        m_mcts->c_profile = c_profile;
     };
 
+    virtual void ponder(Board& board) {
+        m_mcts->startPondering(board);
+    }
+
     virtual void reset() {
         m_mcts->reset();
     }
 
+public:
+    std::shared_ptr<const OpeningBook> m_book; // 为空时不使用开局库
+    bool c_verbose = true; // 是否在每步输出根结点的价值，无界面的评测时关闭
+    bool c_profile = false; // 是否为搜索的各阶段计时并在调试信息中输出。Playout较快时计时的开销可达其用时的一半
+
 protected:
+    Position m_bookMove = Position::npos; // 上一步由开局库给出的着法
     std::unique_ptr<MCTS> m_mcts;
     std::shared_ptr<Policy> m_policy;
     std::chrono::milliseconds c_duration;
+    size_t c_memoryLimit;
+    std::shared_ptr<TimeManager> m_timer;
+};
+
+class AlphaBetaAgent : public Agent {
+public:
+    // 传入timer时按整局的总时长分配每步的搜索时间，duration仅作为未启用时的固定时长
+    AlphaBetaAgent(milliseconds duration, size_t threads = 1, std::shared_ptr<TimeManager> timer = nullptr)
+        : m_search(duration, threads) {
+        m_search.m_timer = std::move(timer);
+    }
+
+    virtual std::string name() {
+        return "AlphaBetaAgent:" + std::to_string(m_search.c_duration.count()) + "ms";
+    }
+
+    virtual Position getAction(Board& board) {
+        return m_search.getAction(board);
+    }
+
+    virtual json debugMessage() {
+        json message = {
+            { "depth",    m_search.m_depth },
+            { "score",    m_search.m_score },
+            { "nodes",    m_search.m_nodes },
+            { "hits",     m_search.m_hits },
+            { "duration", std::to_string(m_search.m_duration.count()) + "ms" }
+        };
+        if (m_search.m_timer) {
+            message["remaining"] = std::to_string(m_search.m_timer->m_remaining.count()) + "ms";
+        }
+        return message;
+    }
+
+    virtual void reset() {
+        m_search.reset();
+    }
+
+protected:
+    AlphaBeta m_search;
 };
 
 class PatternEvalAgent : public Agent {
@@ -2,7 +2,10 @@
 #define GOMOKU_INTERFACE_H_
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 #include "Agent.h"
+#include "SelfPlay.h"
+#include "Tournament.h"
 
 namespace Gomoku::Interface {
 
@@ -57,6 +60,8 @@ inline int KeepAliveBotzoneInterface(Agent& agent) {
 
         cout << output << "\n";
         cout << ">>>BOTZONE_REQUEST_KEEP_RUNNING<<<" << endl; // stdio flushed by endl
+
+        agent.ponder(board); // think on opponent's time until next syncWithBoard
     }
 
     return 0;
@@ -128,6 +133,40 @@ inline int ConsoleInterface(Agent& agent0, Agent& agent1) {
     return board.m_winner == Player::None;
 }
 
+// 以policy进行games局自对弈，将样本逐局写入path处的分片
+inline int SelfPlayInterface(std::shared_ptr<Policy> policy, size_t games, const std::string& path,
+                             size_t iterations = C_SELFPLAY_ITERATIONS, size_t workers = std::thread::hardware_concurrency()) {
+    using namespace std;
+
+    SelfPlay self_play(std::move(policy), iterations, std::max<size_t>(workers, 1));
+    ShardWriter writer(path);
+    size_t finished = 0;
+    self_play.play(games, [&](vector<Sample>& samples) {
+        writer.write(samples);
+        cerr << "Finished game " << ++finished << "/" << games << " with " << samples.size() << " samples." << endl;
+    });
+    writer.close();
+    cout << writer.size() << " samples written to " << path << endl;
+
+    return 0;
+}
+
+// 无界面地进行games局评测对局，开局为opening_moves手的随机局面，对局进度输出至cerr，最终报告输出至cout
+inline int MatchInterface(Tournament::Factory first, Tournament::Factory second, size_t games, size_t opening_moves = 4,
+                          size_t workers = std::thread::hardware_concurrency(), unsigned seed = 0) {
+    using namespace std;
+
+    Tournament tournament(std::move(first), std::move(second), 
+                          Tournament::RandomOpenings((games + 1) / 2, opening_moves, seed), workers);
+    auto stats = tournament.play(games, [&](size_t finished, const MatchStats& stats) {
+        cerr << "Finished game " << finished << "/" << games << ": +" << stats.wins << " -" << stats.losses 
+             << " =" << stats.draws << ", Elo " << showpos << fixed << setprecision(1) << stats.elo() << noshowpos << endl;
+    });
+    cout << stats.summary();
+
+    return 0;
+}
+
 }
 
 
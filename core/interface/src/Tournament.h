@@ -0,0 +1,243 @@
+#ifndef GOMOKU_TOURNAMENT_H_
+#define GOMOKU_TOURNAMENT_H_
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Agent.h"
+
+namespace Gomoku::Interface {
+
+// 一场对抗的结果，胜负均以第一方的视角计
+struct MatchStats {
+    using Duration = std::chrono::steady_clock::duration;
+
+    // 一方的搜索开销
+    struct Side {
+        std::string name;
+        size_t moves = 0;       // 搜索的步数，不含开局
+        size_t playouts = 0;    // 各步Playout数之和（见Agent::playouts）
+        Duration time{};        // 各步同步与思考的用时之和
+        size_t forfeits = 0;    // 因下出无效的一手而判负的局数
+
+        double meanPlayouts() const { return moves ? double(playouts) / moves : 0.0; }
+        double meanTime() const { return moves ? std::chrono::duration<double, std::milli>(time).count() / moves : 0.0; } // 毫秒
+        double playoutRate() const { // 每秒的Playout数
+            const auto seconds = std::chrono::duration<double>(time).count();
+            return seconds > 0 ? playouts / seconds : 0.0;
+        }
+    };
+
+    size_t wins = 0, draws = 0, losses = 0;
+    size_t blackWins = 0, whiteWins = 0; // 按颜色统计的胜局，用于观察先手优势
+    std::array<Side, 2> sides;
+
+    size_t games() const { return wins + draws + losses; }
+
+    // 每局的平均得分，胜计1，和计0.5
+    double score() const { return games() ? (wins + 0.5 * draws) / games() : 0.5; }
+
+    // 得分对应的Elo差，全胜或全负时为正负无穷
+    static double Elo(double score) { return -400.0 * std::log10(1.0 / score - 1.0); }
+    double elo() const { return Elo(score()); }
+
+    // 按各局得分的样本方差，以正态近似求得分的置信区间（z = 1.96时为95%），再换算为Elo差
+    std::pair<double, double> eloInterval(double z = 1.96) const {
+        const auto n = games();
+        if (n == 0) {
+            return { -INFINITY, INFINITY };
+        }
+        const auto mean = score();
+        const auto variance = (wins * std::pow(1 - mean, 2) + draws * std::pow(0.5 - mean, 2) + losses * std::pow(mean, 2)) / n;
+        const auto margin = z * std::sqrt(variance / n);
+        return { Elo(std::max(mean - margin, 0.0)), Elo(std::min(mean + margin, 1.0)) };
+    }
+
+    // 第一方实力更强的可能性（Likelihood of Superiority），和棋不计
+    double los() const {
+        return wins + losses ? 0.5 * (1 + std::erf((double(wins) - losses) / std::sqrt(2.0 * (wins + losses)))) : 0.5;
+    }
+
+    std::string summary() const {
+        auto [lower, upper] = eloInterval();
+        std::ostringstream oss;
+        oss.setf(std::ios::fixed);
+        oss.precision(1);
+        oss << sides[0].name << " vs " << sides[1].name << ": +" << wins << " -" << losses << " =" << draws
+            << " (" << games() << " games, black won " << blackWins << ", white won " << whiteWins << ")\n";
+        oss.precision(3);
+        oss << "score " << score();
+        oss.precision(1);
+        oss << ", Elo " << std::showpos << elo() << " [" << lower << ", " << upper << "] (95%)" << std::noshowpos
+            << ", LOS " << 100 * los() << "%\n";
+        for (auto& side : sides) {
+            oss << side.name << ": " << side.meanTime() << " ms/move";
+            if (side.playouts) {
+                oss << ", " << side.meanPlayouts() << " playouts/move, " << side.playoutRate() << " playouts/s";
+            }
+            if (side.forfeits) {
+                oss << ", " << side.forfeits << " forfeits";
+            }
+            oss << "\n";
+        }
+        return oss.str();
+    }
+};
+
+
+/*
+    无界面的对抗评测：两方以各自的工厂函数在每局开始时创建新的Agent，c_workers个线程并行对局。
+    第g局使用第(g / 2) % openings.size()个开局，g为奇数时交换先后手，使每个开局由双方各执黑一次。
+    按时间控制搜索的Agent在并行对局时彼此争用CPU，因此应结合报告中的每步Playout数比较实力。
+*/
+class Tournament {
+public:
+    using Factory = std::function<std::unique_ptr<Agent>()>;
+    using Opening = std::vector<Position>; // 开局的前几手，由黑棋起交替落下
+
+    Tournament(Factory first, Factory second, std::vector<Opening> openings = { Opening() },
+               size_t c_workers = std::max(std::thread::hardware_concurrency(), 1u))
+        : m_factories{ std::move(first), std::move(second) }, m_openings(std::move(openings)), c_workers(std::max<size_t>(c_workers, 1)) {
+        if (m_openings.empty()) {
+            m_openings.emplace_back();
+        }
+    }
+
+    // 进行games局对局。每局结束后以已完成的局数与当前的统计调用progress（已加锁）
+    MatchStats play(size_t games, const std::function<void(size_t, const MatchStats&)>& progress = nullptr) {
+        MatchStats stats;
+        for (int i = 0; i < 2; ++i) {
+            stats.sides[i].name = m_factories[i]()->name();
+        }
+        if (stats.sides[0].name == stats.sides[1].name) {
+            stats.sides[0].name += " (1)", stats.sides[1].name += " (2)";
+        }
+        std::atomic<size_t> next{ 0 };
+        std::mutex mutex;
+        std::exception_ptr error;
+        size_t finished = 0;
+        auto work = [&]() {
+            try {
+                for (size_t g; (g = next.fetch_add(1)) < games; ) {
+                    auto result = playGame(m_openings[(g / 2) % m_openings.size()], g % 2 == 1);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    merge(stats, result);
+                    if (progress) {
+                        progress(++finished, stats);
+                    }
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next = games; // 令其余线程下完当前一局即退出
+            }
+        };
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < std::min(c_workers, games); ++i) {
+            workers.emplace_back(work);
+        }
+        work(); // 调用线程同样参与对局
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return stats;
+    }
+
+    // 生成count个互不相同的开局，每个开局在棋盘中央的(2 * radius + 1)见方内随机落下moves手，且不分胜负
+    static std::vector<Opening> RandomOpenings(size_t count, size_t moves, unsigned seed = 0, int radius = 3) {
+        std::mt19937 engine(seed);
+        radius = std::min<int>(radius, std::min<int>(WIDTH, HEIGHT) / 2);
+        std::uniform_int_distribution<int> offset(-radius, radius);
+        std::set<Opening> openings;
+        for (size_t attempts = 0; openings.size() < count && attempts < 100 * count; ++attempts) {
+            Board board;
+            while (board.m_moveRecord.size() < moves && board.m_curPlayer != Player::None) {
+                board.applyMove(Position(WIDTH / 2 + offset(engine), HEIGHT / 2 + offset(engine))); // 已有棋子时无效，重新抽取
+            }
+            if (board.m_curPlayer != Player::None) {
+                openings.insert(board.m_moveRecord);
+            }
+        }
+        return { openings.begin(), openings.end() };
+    }
+
+private:
+    // 一局的结果
+    struct GameResult {
+        Player winner = Player::None; // 以颜色计
+        bool swapped = false;         // 第一方是否执白
+        std::array<MatchStats::Side, 2> sides; // 按第一方、第二方排列
+    };
+
+    GameResult playGame(const Opening& opening, bool swapped) const {
+        using Clock = std::chrono::steady_clock;
+        GameResult result;
+        result.swapped = swapped;
+        std::unique_ptr<Agent> agents[2] = { m_factories[0](), m_factories[1]() };
+        auto side = [&](Player player) { return (player == Player::Black) == !swapped ? 0 : 1; }; // 执player的一方
+        Board board;
+        for (auto move : opening) {
+            board.applyMove(move);
+        }
+        for (auto player = board.m_curPlayer; player != Player::None; player = board.m_curPlayer) {
+            const auto i = side(player);
+            auto& stats = result.sides[i];
+            auto start = Clock::now();
+            agents[i]->syncWithBoard(board);
+            auto move = agents[i]->getAction(board);
+            stats.time += Clock::now() - start;
+            stats.moves += 1;
+            stats.playouts += agents[i]->playouts();
+            if (board.applyMove(move) == player) { // 无效的一手直接判负
+                stats.forfeits += 1;
+                result.winner = -player;
+                return result;
+            }
+        }
+        result.winner = board.m_winner;
+        return result;
+    }
+
+    static void merge(MatchStats& stats, const GameResult& result) {
+        if (result.winner == Player::None) {
+            stats.draws += 1;
+        } else {
+            (result.winner == Player::Black ? stats.blackWins : stats.whiteWins) += 1;
+            ((result.winner == Player::Black) == !result.swapped ? stats.wins : stats.losses) += 1;
+        }
+        for (int i = 0; i < 2; ++i) {
+            auto& side = stats.sides[i];
+            side.moves += result.sides[i].moves;
+            side.playouts += result.sides[i].playouts;
+            side.time += result.sides[i].time;
+            side.forfeits += result.sides[i].forfeits;
+        }
+    }
+
+private:
+    std::array<Factory, 2> m_factories;
+    std::vector<Opening> m_openings;
+
+public:
+    size_t c_workers;
+};
+
+}
+
+#endif // !GOMOKU_TOURNAMENT_H_
@@ -10,11 +10,20 @@ int main() {
     MCTSAgent agent3(1s, new RandomPolicy);
     //MCTSAgent agent4(10000, new RandomPolicy);
     MCTSAgent agent6(1000ms, new TraditionalPolicy(5));
+    //agent6.m_book = std::make_shared<Gomoku::OpeningBook>("./data/opening.book");
     MCTSAgent agent6x(1001ms, new TraditionalPolicy(7));
     PatternEvalAgent agent7;
+    //AlphaBetaAgent agent8(1000ms);
     //MCTSAgent agent7x(50000, new PoolRAVEPolicy(2, 0));
+    //MCTSAgent agent9(1000ms, new AlphaZeroPolicy("./data/trained_models/native/model-latest.weights"));
 
     return ConsoleInterface(agent6, agent6x);
     //return KeepAliveBotzoneInterface(agent6);
     //return BotzoneInterface(agent6);
+    //return SelfPlayInterface(std::make_shared<TraditionalPolicy>(5), 100, "./data/selfplay.shard");
+    //return MatchInterface([] {
+    //    auto agent = std::make_unique<MCTSAgent>(100ms, new TraditionalPolicy(5));
+    //    agent->c_verbose = false;
+    //    return agent;
+    //}, [] { return std::make_unique<PatternEvalAgent>(); }, 1000);
 }
\ No newline at end of file
@@ -5,4 +5,5 @@
 #include "policies/Random.h"
 #include "policies/PoolRAVE.h"
 #include "policies/Traditional.h"
+#include "policies/AlphaZero.h"
 #endif // !GOMOKU_INTERFACE_PCH_H_
\ No newline at end of file
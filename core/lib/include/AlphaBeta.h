@@ -0,0 +1,90 @@
+#ifndef GOMOKU_ALPHABETA_H_
+#define GOMOKU_ALPHABETA_H_
+#include "MCTS.h"      // Gomoku::TimeManager, Gomoku::milliseconds
+#include "algorithms/Threat.hpp" // Gomoku::Algorithms::ThreatSolver
+#include <vector>      // std::vector
+#include <memory>      // std::unique_ptr, std::shared_ptr
+#include <atomic>      // std::atomic
+#include <cstdint>     // std::uint64_t
+
+namespace Gomoku {
+
+inline namespace Config {
+    // α-β搜索相关的默认配置
+    constexpr int C_AB_MAX_DEPTH = 32; // 迭代加深的最大深度，不超过C_AB_MAX_PLY
+    constexpr int C_AB_MAX_PLY = 64; // 搜索树的最大层数，决定杀手表的大小
+    constexpr std::size_t C_AB_CANDIDATES = 10; // 每个结点按启发式概率保留的候选手数
+    constexpr std::size_t C_AB_TABLE_SIZE = 1 << 20; // 置换表的项数（向上取整为2的幂），每项16字节
+}
+
+/*
+    迭代加深的α-β搜索（PVS），作为MCTS之外的另一种搜索，适合Playout次数不足以收敛的短时限。
+    ① 局面由各线程独立的Evaluator增量维护，以Heuristic::EvaluationValue为静态评估，
+       以EvaluationProbs经DecisiveFilter筛选后的概率排序并截取候选手，再以置换表、杀手与历史启发调整顺序。
+    ② 搜索前先以ThreatSolver在根局面上求解VCF，找到时直接落下首手。
+    ③ 多线程时采用Lazy SMP：各线程以不同的起始深度独立地迭代加深，只通过无锁的置换表共享结果，采用0号线程的结论。
+    ④ 分数以当前应下一方为正，WIN - ply表示ply层后取胜。
+*/
+class AlphaBeta {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int WIN = 30000; // 胜负的分数，赢得越早越高
+    static constexpr int EVAL_SCALE = 10000; // 静态评估（[-1, 1]）放大至整数分数的倍数
+
+    AlphaBeta(milliseconds c_duration = C_DURATION, std::size_t c_threads = 1, std::size_t c_tableSize = C_AB_TABLE_SIZE);
+
+    ~AlphaBeta();
+
+    // 在棋盘上搜索当前应下一方的最好手，棋盘状态不变
+    Position getAction(Board& board);
+
+    // 清空置换表与历史启发，并恢复时间管理的整局时长
+    void reset();
+
+public:
+    milliseconds c_duration; // 未启用时间管理时每步的搜索时长
+    int c_maxDepth = C_AB_MAX_DEPTH;
+    std::size_t c_candidates = C_AB_CANDIDATES;
+    std::size_t c_vcfNodes = C_VCF_NODES; // 根局面上VCF搜索的结点上限，为0时不搜索
+    std::shared_ptr<TimeManager> m_timer; // 按整局总时长分配每步时长，为空时每步固定搜索c_duration
+
+    // 上一步搜索的结果
+    int m_depth = 0; // 完成的最大深度，由VCF直接得出时为0
+    int m_score = 0; // 最好手的分数
+    std::size_t m_nodes = 0; // 各线程访问的结点数之和
+    std::size_t m_hits = 0; // 置换表的命中次数（各线程之和）
+    milliseconds m_duration = 0ms;
+
+private:
+    struct Worker;
+
+    // 置换表项：键为局面的规范哈希，着法按规范变换存储，对称的局面共用表项。
+    // check为键与data的异或，读到被并发写入撕裂的表项时校验失败，视为未命中
+    struct Entry {
+        std::atomic<std::uint64_t> check;
+        std::atomic<std::uint64_t> data;
+    };
+
+    enum Bound : unsigned { Upper = 1, Lower = 2, Exact = Upper | Lower };
+
+    int search(Worker& worker, int depth, int alpha, int beta, int ply);
+
+    // 单个线程的迭代加深，起始深度为first_depth
+    void deepen(Worker& worker, int first_depth);
+
+    bool probe(std::uint64_t hash, int& depth, int& score, Bound& bound, Position& move) const;
+    void store(std::uint64_t hash, int depth, int score, Bound bound, Position move);
+
+private:
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    Algorithms::ThreatSolver m_solver; // 根局面的VCF求解器，置换表跨回合保留
+    std::unique_ptr<Entry[]> m_table;
+    std::size_t m_mask;
+    std::atomic<bool> m_stop{ false };
+    Clock::time_point m_start, m_deadline;
+};
+
+}
+
+#endif // !GOMOKU_ALPHABETA_H_
@@ -3,18 +3,35 @@
 #include <utility> // std::pair, std::size_t
 #include <vector>  // std::vector
 #include <array>   // std::array
+#include <type_traits> // std::conditional_t
+#include <tuple>   // std::tuple
+#include <cstdint> // std::uint64_t
 #include <Eigen/Dense> // Eigen::VectorXf
+#ifdef _MSC_VER
+#include <intrin.h> // _BitScanForward64
+#endif
 
 namespace Gomoku {
 
+// 棋盘边长在编译期确定，以便各定长数组与循环完全展开。构建时以GOMOKU_BOARD_WIDTH指定，
+// 例如9/11路小棋盘上的自对弈训练或19路的对局，一份二进制只对应一种尺寸。对称变换要求棋盘为正方形。
+#ifndef GOMOKU_BOARD_WIDTH
+#define GOMOKU_BOARD_WIDTH 15
+#endif
+
 inline namespace Config {
 // 游戏的基本配置
 enum GameConfig {
-    WIDTH = 15, HEIGHT = 15, MAX_RENJU = 5, 
+    WIDTH = GOMOKU_BOARD_WIDTH, HEIGHT = GOMOKU_BOARD_WIDTH, MAX_RENJU = 5, 
     BOARD_SIZE = WIDTH*HEIGHT
 };
 }
 
+static_assert(MAX_RENJU <= WIDTH && MAX_RENJU <= HEIGHT && WIDTH < 32 && HEIGHT < 32, "unsupported board dimensions");
+
+// 以格点下标为元素的紧凑数组（空位集合、PositionSet等）所用的类型，不超过256格时只占8位
+using CellIndex = std::conditional_t<BOARD_SIZE <= 256, std::uint8_t, std::uint16_t>;
+
 // 玩家概念的抽象封装
 enum class Player : short { 
     White = -1, None = 0, Black = 1 
@@ -56,6 +73,39 @@ struct Position {
 };
 
 
+// 位棋盘：以若干64位整数按位存储棋盘上的一组格点，第i位对应Position(i)。
+struct Bitboard {
+    static constexpr int Words = (BOARD_SIZE + 63) / 64;
+
+    std::array<std::uint64_t, Words> words = {};
+
+    bool test(Position pose) const { return words[pose.id >> 6] >> (pose.id & 63) & 1; }
+    void set(Position pose)        { words[pose.id >> 6] |= std::uint64_t(1) << (pose.id & 63); }
+    void reset(Position pose)      { words[pose.id >> 6] &= ~(std::uint64_t(1) << (pose.id & 63)); }
+
+    // 按下标升序对每个置位的格点调用func
+    template <typename Func>
+    void forEach(Func&& func) const {
+        for (int i = 0; i < Words; ++i) {
+            for (auto word = words[i]; word != 0; word &= word - 1) {
+                func(Position(64 * i + LowestBit(word)));
+            }
+        }
+    }
+
+    // 最低位1的下标，要求word非0
+    static int LowestBit(std::uint64_t word) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return int(index);
+#else
+        return __builtin_ctzll(word);
+#endif
+    }
+};
+
+
 class Board {
 // 公开接口部分
 public:
@@ -91,6 +141,12 @@ public:
     // 从性能角度考虑，只需对最后落子周围进行遍历。
     bool checkGameEnd();
 
+    // 玩家在pose处沿第dir个方向（依次为横、竖、主对角、副对角）的连子数，pose处不是该玩家的子时为0。player不可为None。
+    int runLength(Position pose, Player player, int dir) const;
+
+    // 五连威胁：玩家落子于空位pose后能否成五。player不可为None。
+    bool completesFive(Position pose, Player player) const;
+
     // 重置棋盘到初始状态。
     void reset();
     
@@ -104,8 +160,7 @@ public:
         return status;
     }
 
-    // 通过Player枚举获取对应棋盘状态
-    std::array<bool, BOARD_SIZE>&       moveStates(Player player) { return m_moveStates[static_cast<int>(player) + 1]; }
+    // 通过Player枚举获取对应棋盘状态。仅提供只读接口，以保证与m_lines及空位集合一致。
     const std::array<bool, BOARD_SIZE>& moveStates(Player player) const { return m_moveStates[static_cast<int>(player) + 1]; }
     
     // 获取棋盘在对应Position上的Player状态。仅提供只读接口。
@@ -146,12 +201,95 @@ public:
     std::array<bool, BOARD_SIZE> m_moveStates[3] = {};
     std::size_t m_moveCounts[3] = {};
 
+    /*
+        空位集合：m_freeCells的前moveCounts(Player::None)项为全部空位（顺序任意），m_freeIndices为各空位在其中的下标。
+        落子时将该空位与末项交换后移除，悔棋时追加回末尾，因此均匀随机落子只需一次随机数抽取。
+    */
+    std::array<CellIndex, BOARD_SIZE> m_freeCells;
+    std::array<CellIndex, BOARD_SIZE> m_freeIndices;
+
+    /*
+        黑白双方按方向打包的棋子分布，用于快速判断连珠。下标0为白棋，1为黑棋。
+        每条横线、竖线与两个方向的斜线各占一个字（边长不超过16时为16位），线上相邻的格点对应字中相邻的位，
+        因此判断五连只需对一个字做几次移位与求与。线的总数与BoardMap::m_lineMap一致。
+    */
+    using LineWord = std::conditional_t<(WIDTH <= 16 && HEIGHT <= 16), std::uint16_t, std::uint32_t>;
+    using Lines = std::array<LineWord, 3 * (WIDTH + HEIGHT) - 2>;
+    Lines m_lines[2] = {};
+
     //保存了棋局的完整记录的栈式结构。
     std::vector<Position> m_moveRecord;
 };
 
-// 统一的随机数引擎
+class RandomEngine;
+
+/*
+    一次性的随机模拟棋盘：从Board复制出双方的连珠线与空位集合，均匀随机地下至终局后直接丢弃。
+    不记录棋谱，也不维护格点状态与计数，因此落子只需更新四条线，且无需悔棋。
+    需要模拟中的棋谱时（如AMAF统计），仍应在Board上模拟。
+*/
+class RolloutBoard {
+public:
+    explicit RolloutBoard(const Board& board);
 
+    // 下至终局，返回 <赢家, 模拟的手数>。棋盘已结束时直接返回其结果。
+    std::tuple<Player, int> play(RandomEngine& engine);
+
+    /*
+        从board出发进行count局独立的随机模拟，返回各结果的局数，下标依次为白胜、和局、黑胜（即Player值 + 1）。
+        只从board复制一次，之后每局从该副本重新开始，结果的分布与逐局调用play相同。
+        注：曾尝试多局交错推进以利用指令级并行，但各局状态无法留在寄存器中，实测（每组2~8局）反而慢约25%~45%。
+    */
+    static std::array<int, 3> PlayMany(const Board& board, int count, RandomEngine& engine);
+
+private:
+    Board::Lines m_lines[2];
+    std::array<CellIndex, BOARD_SIZE> m_freeCells;
+    int m_freeCount;
+    Player m_curPlayer;
+    Player m_winner;
+};
+
+// 统一的随机数引擎，采用xoshiro256**算法。满足UniformRandomBitGenerator要求，可用于标准库的各种分布。
+// 相比std::mt19937，状态只有32字节，生成速度也更快。
+class RandomEngine {
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type(0); }
+
+    // 线程局部的引擎实例，各线程首次使用时分别由std::random_device播种
+    static RandomEngine& Local();
+
+    // 由std::random_device播种
+    RandomEngine();
+
+    // 由给定种子经SplitMix64扩展为初始状态，用于复现随机序列
+    explicit RandomEngine(std::uint64_t seed);
+
+    result_type operator()() {
+        const auto result = rotl(m_state[1] * 5, 7) * 9;
+        const auto t = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+        return result;
+    }
+
+    // 返回[0, bound)内的均匀随机整数。采用乘法取高位代替取模，偏差不超过bound / 2^32。
+    std::uint32_t below(std::uint32_t bound) {
+        return static_cast<std::uint32_t>(((*this)() >> 32) * bound >> 32);
+    }
+
+private:
+    static constexpr std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    std::uint64_t m_state[4];
+};
 
 }
 
@@ -1,10 +1,18 @@
 #ifndef GOMOKU_MCTS_H_
 #define GOMOKU_MCTS_H_
 #include "Game.h" // Gomoku::Player, Gomoku::Position, Gomoku::Board
+#include "Mapping.h" // Gomoku::SymmetricHash
 #include <vector>      // std::vector
 #include <memory>      // std::unique_ptr
 #include <chrono>      // std::milliseconds
 #include <functional>  // std::function
+#include <array>       // std::array
+#include <cstdint>     // std::uint16_t, std::uint32_t
+#include <utility>     // std::as_const
+#include <atomic>      // std::atomic
+#include <thread>      // std::thread, std::this_thread::yield
+#include <mutex>       // std::mutex
+#include <condition_variable> // std::condition_variable
 #include <Eigen/Dense> // Eigen::VectorXf
 
 namespace Gomoku {
@@ -17,11 +25,194 @@ inline namespace Config {
     constexpr double C_PUCT = 5.0;
     constexpr size_t C_ITERATIONS = 10000;
     constexpr milliseconds C_DURATION = 1000ms;
+    constexpr size_t C_BATCH_SIZE = 16;
+    constexpr double C_WIDENING = 0.0; // 逐步展开的系数，为0时不启用
+    constexpr size_t C_MEMORY_LIMIT = 0; // 树所用内存的上限（字节），为0时不限
+    constexpr size_t C_CHECK_INTERVAL = 16; // 按时间控制搜索时，每隔多少次Playout检查一次时钟
+    constexpr size_t C_MOVES_TO_GO = 20; // 分配每步时长时，假定对局还需下的步数
+    constexpr size_t C_HISTORY_DEPTH = 8; // 启用祖先链时，根结点保留的祖先层数
 }
 
+// 蒙特卡洛树结点的内存池。
+// 结点按大小分桶，从按ChunkSize对齐的大块内存中顺序切分，释放后挂回对应分桶的空闲链表。
+// 每块内存的头部记录了其所属的池，因此结点无论在何处被销毁，都能归还到分配它的池中。
+// 不超过SmallBlockSize的对象（结点）按Granularity分桶，更大的对象（子结点数组）按2的幂分桶。
+// 池只由一个线程使用；只有Reclaimer的回收线程例外，它归还的块先压入无锁的远程链表，待池的使用者分配时再挂回空闲链表。
+class NodePool {
+public:
+    static constexpr std::size_t ChunkSize = 1 << 16;    // 每块内存的大小，同时也是其对齐值
+    static constexpr std::size_t Granularity = 16;       // 小对象的分桶粒度
+    static constexpr std::size_t SmallBlockSize = 512;   // 按粒度分桶的最大对象大小
+    static constexpr std::size_t MaxBlockSize = 1 << 14; // 可由内存池分配的最大对象大小
+
+    // 在作用域内，将当前线程的结点分配重定向至指定的内存池。
+    class Scope {
+    public:
+        explicit Scope(NodePool& pool) : m_prev(Current()) { Current() = &pool; }
+        ~Scope() { Current() = m_prev; }
+    private:
+        NodePool* m_prev;
+    };
+
+    // 从当前线程所用的内存池中分配结点。未处于任何Scope中时，使用全局默认池。
+    static void* Allocate(std::size_t size);
+
+    // 将结点内存归还至分配它的内存池。
+    static void Deallocate(void* ptr);
+
+    // 分配/归还结点之外的辅助缓冲区（如子结点数组），不计入结点数。
+    static void* AllocateBuffer(std::size_t size);
+    static void DeallocateBuffer(void* ptr);
+
+    // 当前线程所用的内存池是否已用尽其预算。
+    static bool Exhausted();
+
+    NodePool() = default;
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    ~NodePool(); // 一次性归还所有内存块。调用前应保证池中已无存活的结点。
+
+    std::size_t size() const { return m_size - m_remoteNodes.load(std::memory_order_relaxed); } // 存活的结点数
+    std::size_t bytes() const { return m_bytes - m_remoteBytes.load(std::memory_order_relaxed); } // 存活的结点与缓冲区所占的字节数（按分桶的块大小计）
+    std::size_t allocated() const { return m_allocated; } // 累计分配过的结点数
+    std::size_t capacity() const { return m_chunks.size() * ChunkSize; } // 已向系统申请的字节数
+
+    // 预算只是供使用者查询的软上限，超出预算后分配仍会成功。
+    void setBudget(std::size_t budget) { m_budget = budget; }
+    bool exhausted() const { return m_bytes >= m_budget; }
+
+private:
+    struct Chunk;
+    static constexpr std::size_t SmallBuckets = SmallBlockSize / Granularity;
+    static constexpr std::size_t Buckets = SmallBuckets + 5; // 1KB, 2KB, 4KB, 8KB, 16KB
+
+    static std::size_t BucketOf(std::size_t size);
+    static std::size_t BlockSize(std::size_t bucket);
+
+    static NodePool*& Current();
+    static NodePool& Default();
+
+    static NodePool& Owner(void* ptr);
+
+    void* allocate(std::size_t size);
+    void deallocate(void* ptr);
+
+    // 由回收线程归还块，以及由池的使用者将这些块挂回空闲链表
+    void deallocateRemote(void* ptr, bool node);
+    void collectRemote();
+
+    std::vector<Chunk*> m_chunks;
+    std::array<void*, Buckets> m_freeLists = {}; // 每个分桶的空闲链表，链接指针就地存储在空闲块中
+    std::array<std::pair<char*, char*>, Buckets> m_cursors = {}; // 每个分桶当前内存块中未切分区间
+    std::size_t m_size = 0;
+    std::size_t m_allocated = 0;
+    std::size_t m_bytes = 0;
+    std::size_t m_budget = SIZE_MAX;
+    std::atomic<void*> m_remoteFrees{ nullptr }; // 回收线程归还的块，链接指针就地存储
+    std::atomic<std::size_t> m_remoteNodes{ 0 }, m_remoteBytes{ 0 }; // 其中尚未挂回空闲链表的结点数与字节数
+};
+
+
+// 轻量的自旋锁，用于树并行搜索中保护结点。仅占1字节，可放入Node的对齐空隙中。
+// 复制或移动时不传递锁状态，新对象总是处于未加锁状态。
+class SpinLock {
+public:
+    SpinLock() = default;
+    SpinLock(const SpinLock&) { }
+    SpinLock& operator=(const SpinLock&) { return *this; }
+
+    void lock() {
+        while (m_flag.exchange(true, std::memory_order_acquire)) {
+            // 先只读等待，减少缓存行争用；久等不到时让出时间片，以免持有者被调度出去后空转
+            for (int spins = 0; m_flag.load(std::memory_order_relaxed); ++spins) {
+                if (spins >= 64) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+    void unlock() { m_flag.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<bool> m_flag{ false };
+};
+
+
+struct Node;
+class TranspositionTable;
+
+// 子结点集合。
+// 父结点以结构数组的形式连续存储各子结点的统计量（位置、先验概率、价值、访问次数），
+// 子树指针则单独存放，使Select等扫描全部子结点的过程成为无需解引用子结点的线性遍历。
+// 整个集合占用一块由NodePool分配的缓冲区，按 [子结点指针|先验概率|价值|访问次数|位置] 排列，
+// 容量取4的倍数，以保证各数组均按16字节对齐。
+// 结点自身的统计量仍以Node中的字段为准，修改后需经由sync同步至父结点中的副本。
+// 逐步展开时，尚未创建的子结点只在size()之后登记位置与先验概率（见defer），待materialize时才创建结点。
+class ChildList {
+public:
+    ChildList() = default;
+    ChildList(ChildList&& other) noexcept;
+    ChildList& operator=(ChildList&& other) noexcept;
+    ~ChildList(); // 销毁所有子结点
+
+    std::size_t size() const { return m_size; }
+    std::size_t pending() const { return m_pending; } // 登记了但尚未创建的子结点数
+    std::size_t capacity() const { return m_capacity; }
+    bool empty() const { return m_size == 0; }
+    void reserve(std::size_t capacity);
+
+    // 子结点访问，元素为观察指针。
+    Node* operator[](std::size_t i) const { return m_nodes[i]; }
+    Node* const* begin() const { return m_nodes; }
+    Node* const* end() const { return m_nodes + m_size; }
+
+    // 子结点统计量的连续数组，下标与子结点一一对应。其后的pending()项为尚未创建的子结点的位置与先验概率。
+    const Position* positions() const { return reinterpret_cast<const Position*>(visits() + m_capacity); }
+    const float* priors() const { return reinterpret_cast<const float*>(m_nodes + m_capacity); }
+    const float* values() const { return priors() + m_capacity; }
+    const std::uint32_t* visits() const { return reinterpret_cast<const std::uint32_t*>(values() + m_capacity); }
+    Position* positions() { return const_cast<Position*>(std::as_const(*this).positions()); }
+    float* priors() { return const_cast<float*>(std::as_const(*this).priors()); }
+    float* values() { return const_cast<float*>(std::as_const(*this).values()); }
+    std::uint32_t* visits() { return const_cast<std::uint32_t*>(std::as_const(*this).visits()); }
+
+    // 添加子结点，并从其字段初始化对应的统计量。
+    void emplace_back(std::unique_ptr<Node> child);
+
+    // 登记一个暂不创建的子结点，排在已登记的子结点之后。
+    void defer(Position pose, float prior);
+
+    // 创建首个登记了的子结点。child应以下标size()处登记的位置与先验概率创建。
+    void materialize(std::unique_ptr<Node> child);
+
+    // 取出第i个子结点的所有权，原位置留空。一般用于随即销毁整个集合的场合（如推进根结点）。
+    std::unique_ptr<Node> release(std::size_t i);
+
+    // 将release取出的子结点放回其原位置（child->index），并同步统计量。
+    void restore(std::unique_ptr<Node> child);
+
+    // 交换两个子结点的位置。
+    void swap(std::size_t i, std::size_t j);
+
+    // 将子结点自身的统计量同步至集合中的副本。
+    void sync(const Node* child);
+
+private:
+    static std::size_t BufferSize(std::size_t capacity);
+
+    Node** m_nodes = nullptr; // 缓冲区起始处
+    std::uint16_t m_size = 0;
+    std::uint16_t m_pending = 0;
+    std::uint16_t m_capacity = 0;
+};
+
+
 // 蒙特卡洛树结点。
 // 由于整个树的结点数量十分庞大，因此其内存布局务必谨慎设计。
-// 32位下，sizeof(Node) == 32；64位下为56。
+// 32位下，sizeof(Node) == 36；64位下为48。
+// 树并行搜索时的加锁约定（加锁顺序一律为父结点先于子结点）：
+//   * 结点的锁保护其子结点集合（包括其中的统计量副本），以及各子结点的附加统计量（如AMAF价值）。
+//   * 结点自身的统计量需同时持有父结点与自身的锁才能修改，持有其中任意一个即可读取。
 struct Node {
     /* 
         树结构部分 - 父结点。
@@ -41,16 +232,19 @@ struct Node {
         结点价值部分：
           * state_value: 结点对应局面对于结点对应玩家的价值。一般为胜率。
           * action_prob: 在父结点对应的局面下，选择该动作的概率。
+          * index:       结点在父结点的子结点集合中的下标，用于同步统计量。
     */
     float state_value = 0.0;
     float action_prob = 0.0;
+    std::uint16_t index = 0;
+    mutable SpinLock mutex = {}; // 树并行搜索时使用，单线程搜索时不加锁
     size_t node_visits = 0;
 
     /*
         树结构部分 - 子结点。
-        结点为独有指针集合，对每个子结点拥有所有权。
+        集合对每个子结点拥有所有权，并连续存储其统计量。
     */
-    std::vector<std::unique_ptr<Node>> children = {};
+    ChildList children = {};
 
     /* 
         构造与赋值函数。
@@ -60,12 +254,132 @@ struct Node {
     Node(Node&&) = default;
     Node& operator=(Node&&) = default;
 
+    /*
+        内存管理：结点（包括派生结点）一律由NodePool分配。
+        派生结点经由基类指针销毁时，也能通过内存块头部找回正确的分桶。
+    */
+    static void* operator new(std::size_t size) { return NodePool::Allocate(size); }
+    static void operator delete(void* ptr) { NodePool::Deallocate(ptr); }
+
     /* 辅助函数 */
     bool isLeaf() const { return children.empty(); }
     bool isFull(const Board& board) const { return children.size() == board.moveCounts(Player::None); }
 };
 
 
+// 后台回收线程。推进根结点后丢弃的子树交由其销毁，使stepForward的开销与被丢弃的子树大小无关。
+// 析构时等待所有子树销毁完毕，因此应先于子树所属的内存池析构。
+class Reclaimer {
+public:
+    Reclaimer();
+    Reclaimer(const Reclaimer&) = delete;
+    Reclaimer& operator=(const Reclaimer&) = delete;
+    ~Reclaimer();
+
+    // 提交一棵待销毁的子树
+    void discard(std::unique_ptr<Node> node);
+
+    // 等待已提交的子树全部销毁
+    void wait();
+
+private:
+    void run();
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup, m_idle;
+    std::vector<std::unique_ptr<Node>> m_queue;
+    bool m_busy = false, m_stop = false;
+    std::thread m_thread; // 最后声明，以保证线程启动时其余成员均已初始化
+};
+
+
+// 整局对局的时间管理。按剩余的总时长为每步分配基准时长，并在搜索中决定提前结束或延长：
+//   * 最好的根子结点领先次好者的访问次数，即使剩余时间内的Playout全部给予次好者也无法追上时，提前结束。
+//   * 到达基准时长时，若两者的访问次数接近，延长一次（不超过每步上限与剩余的总时长）。
+// 提前结束省下的时间留给之后的步数。时钟采用steady_clock，不受系统时间调整的影响。
+class TimeManager {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // total: 整局可用的总时长；min_move/max_move: 每步搜索时长的下限与上限
+    TimeManager(milliseconds total, milliseconds min_move, milliseconds max_move, size_t c_movesToGo = C_MOVES_TO_GO);
+
+    // 开始一步的计时，并分配该步的基准时长与延长后的时长
+    void start();
+
+    // 根据已完成的Playout数与访问次数最多的两个根子结点（best >= second），判断是否应结束本步搜索
+    bool shouldStop(size_t playouts, size_t best, size_t second);
+
+    // 结束一步的计时，从剩余的总时长中扣除本步所用的时长
+    void finish();
+
+    // 恢复整局的总时长，用于新的一局
+    void reset();
+
+public:
+    milliseconds c_total, c_minMove, c_maxMove;
+    size_t c_movesToGo;
+    double c_closeRatio = 0.8; // 次好者的访问次数不低于最好者的该比例时，视为两者接近
+
+    milliseconds m_remaining; // 剩余的总时长
+    milliseconds m_budget = 0ms; // 本步的基准时长
+    milliseconds m_spent = 0ms; // 上一步实际所用的时长
+    bool m_stoppedEarly = false; // 上一步是否提前结束
+    bool m_extended = false; // 上一步是否延长了搜索
+
+private:
+    Clock::time_point m_start, m_deadline;
+    milliseconds m_extension = 0ms; // 本步延长后的时长
+};
+
+
+// 搜索的运行统计，用于记录每一步的搜索效率。
+// 各线程累加至各自策略的m_stats中，每轮搜索开始时清零，结束后由MCTS汇总。
+// 各阶段的计时需读取时钟，在Playout很快的局面（如终盘的随机模拟）中开销可观，故只在timed时进行。
+struct SearchStats {
+    enum Phase { Select, Simulate, Expand, BackPropogate, Phases };
+
+    // 将作用域内的用时计入某一阶段，并计一次调用
+    class Timer {
+    public:
+        Timer(SearchStats& stats, Phase phase) : m_stats(stats), m_phase(phase) {
+            if (m_stats.timed) {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+        ~Timer() {
+            if (m_stats.timed) {
+                m_stats.time[m_phase] += std::chrono::steady_clock::now() - m_start;
+            }
+            m_stats.calls[m_phase] += 1;
+        }
+    private:
+        SearchStats& m_stats;
+        Phase m_phase;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    bool timed = false; // 是否为各阶段计时
+    std::array<std::chrono::nanoseconds, Phases> time = {}; // 各阶段的累计用时
+    std::array<std::size_t, Phases> calls = {};  // 各阶段的调用次数
+    std::size_t nodes = 0;        // 新分配的结点数
+    std::size_t expansions = 0;   // 扩展的叶结点数
+    std::size_t children = 0;     // 扩展时登记的子结点数（包括逐步展开时尚未创建的）
+    std::size_t depth = 0;        // 各次选择抵达的深度之和
+    std::size_t maxDepth = 0;     // 选择抵达的最大深度
+    std::size_t applies = 0;      // 评估器的增量落子次数
+    std::size_t reverts = 0;      // 评估器的增量悔棋次数
+    std::size_t cacheHits = 0;    // CachedApplyMove命中缓存的次数
+    std::size_t cacheMisses = 0;  // CachedApplyMove未命中缓存的次数
+
+    double branching() const { return expansions ? double(children) / expansions : 0.0; }
+    double averageDepth() const { return calls[Select] ? double(depth) / calls[Select] : 0.0; }
+    double hitRatio() const { return cacheHits + cacheMisses ? double(cacheHits) / (cacheHits + cacheMisses) : 0.0; }
+
+    SearchStats& operator+=(const SearchStats& other);
+};
+
+
 class Policy {
 public:
     /*
@@ -79,10 +393,17 @@ public:
         ① 直接扩展一整层结点，并根据EvalResult中的概率向量为每个结点赋初值。
         ② 已经有子的位置概率应为0，防止被添加进树中。可以额外加一层在正常情况下会被短路的检查。
         ③ 返回值为新增的结点数。
+        ④ 概率向量以引用传入，扩展时无需复制。
     */
-    using ExpandFunc = std::function<size_t(Node*, Board&, const Eigen::VectorXf)>;
+    using ExpandFunc = std::function<size_t(Node*, Board&, const Eigen::VectorXf&)>;
     ExpandFunc expand;
 
+    /*
+        稀疏形式的先验概率，只列出概率不为0的 <位置, 概率> 对。
+        先验只集中在少数位置时（如启发式或神经网络给出的概率），可代替稠密向量传给Default::Expand，扩展时只按列表长度预留空间。
+    */
+    using SparseProbs = std::vector<std::pair<Position, float>>;
+
     /*
         当Tree-Policy抵达中止点时，用于将棋下完（可选）并评估场面价值的Default-Policy：
         ① 在函数调用前后，一般应保证棋盘的状态不变。
@@ -100,9 +421,22 @@ public:
     using UpdateFunc = std::function<void(Node*, Board&, double)>;
     UpdateFunc backPropogate;
 
+    /*
+        批量评估叶结点局面的函数（可选），一般用于神经网络一次前向传播评估多个局面：
+        ① 返回值与传入的局面一一对应，含义同simulate。
+        ② 若提供该函数，MCTS会先在虚拟损失的引导下收集至多c_batchSize个叶结点，统一评估后再逐个扩展与回传。
+    */
+    using BatchEvalFunc = std::function<std::vector<EvalResult>(const std::vector<Board>&)>;
+    BatchEvalFunc simulateBatch;
+
 public:
-    // 当其中某一项传入nullptr时，该项将使用一个默认策略初始化。
-    Policy(SelectFunc = nullptr, ExpandFunc = nullptr, EvalFunc = nullptr, UpdateFunc = nullptr, double = C_PUCT);
+    // 当其中某一项传入nullptr时，该项将使用一个默认策略初始化（批量评估函数除外，其默认为不启用）。
+    Policy(SelectFunc = nullptr, ExpandFunc = nullptr, EvalFunc = nullptr, UpdateFunc = nullptr, double = C_PUCT, 
+           BatchEvalFunc = nullptr, size_t = C_BATCH_SIZE);
+
+    // 复制出一个参数相同、状态独立的策略，供多线程搜索的各线程使用。
+    // 默认返回nullptr，表示该策略不支持复制（如由Python函数拼装的策略），只能单线程搜索。
+    virtual std::shared_ptr<Policy> clone() const { return nullptr; }
 
     // 用于多态生成树节点的Factory函数。
     virtual std::unique_ptr<Node> createNode(Node* parent, Position pose, Player player, float value, float prob);
@@ -128,18 +462,26 @@ public:
 
 public: // 共通属性
     double c_puct; // PUCT公式的Exploit-Explore平衡因子
+    size_t c_batchSize; // 批量评估时每批的叶结点数
+    double c_widening = C_WIDENING; // 逐步展开的系数：大于0时，结点被访问n次后才创建第⌈c_widening·√(n+1)⌉个子结点
     size_t m_initActs = 0; // MCTS的一轮Playout开始时，Board已下的棋子数。
+    bool m_parallel = false; // 是否用于树并行搜索（由MCTS设置）。此时需对结点加锁。
+    bool m_virtualLoss = false; // 是否在选择阶段施加虚拟损失（由MCTS在树并行或批量评估时设置）。
+    SearchStats m_stats; // 该策略所在线程的搜索统计（由MCTS在每轮搜索开始时清零）。
+    Position m_provenMove = Position::npos; // 由prepare证明的根局面必胜手（如VCF）。非npos时MCTS不再进行Playout，直接选择该手。
 };
 
 
 class MCTS {
 public:
     // 通过时间控制模拟迭代。为默认构造方法。
+    // c_threads > 1 时，由多个线程共享同一棵树并行搜索，此时要求策略支持clone()。
     MCTS(
         milliseconds c_duration  = C_DURATION,
         Position     last_move   = -1,
         Player       last_player = Player::White,
-        std::shared_ptr<Policy> policy = nullptr
+        std::shared_ptr<Policy> policy = nullptr,
+        size_t       c_threads   = 1
     );
 
     // 通过次数控制模拟迭代。
@@ -147,36 +489,145 @@ public:
         size_t   c_iterations,
         Position last_move   = -1,
         Player   last_player = Player::White,
-        std::shared_ptr<Policy> policy = nullptr
+        std::shared_ptr<Policy> policy = nullptr,
+        size_t   c_threads   = 1
     );
 
+    ~MCTS(); // 先停止后台搜索
+
     Position getAction(Board& board);
     Policy::EvalResult evalState(Board& board); // Tree-policy的评估函数
+    Eigen::VectorXf rootVisits(Board& board);   // 搜索后返回根结点各子结点的访问次数，不推进根结点
+
+    // 在对手思考期间于后台线程上持续搜索（不受时间与次数限制），直至停止。
+    // 其余公开的成员函数在执行前都会先停止后台搜索，因此对手落子后经由syncWithBoard/stepForward即可保留已搜索的子树。
+    void startPondering(Board board);
+    void stopPondering();
     
     // 将蒙特卡洛树往深推进一层
     Node* stepForward();                      // 选出子结点中的最好手
     Node* stepForward(Position next_move);    // 根据提供的动作往下走
+    Node* stepBack();                         // 退回上一层祖先（需启用c_historyDepth），无祖先时不变
 
-    void syncWithBoard(Board& board); // 同步MCTS与棋盘，使得树的根节点为棋盘的最后一手
-    void reset(); // 重置蒙特卡洛树与其所用的策略
+    // 同步MCTS与棋盘，使得树的根节点为棋盘的最后一手。
+    // 棋盘回退（悔棋、重开）时，沿保留的祖先链退回与棋谱一致的最近祖先；
+    // 余下的各手以另一种次序出现在树中时（置换），沿访问次数最多的已有路径推进，而非新建结点。
+    void syncWithBoard(Board& board);
+    void reset(); // 重置蒙特卡洛树与其所用的策略。祖先链可退回至开局时，复用开局的子树
 
 private:
+    friend class EnsembleMCTS;
+
     // 蒙特卡洛树的一轮迭代
-    size_t playout(Board& board);
+    size_t playout(Board& board, Policy& policy);
+
+    // 批量评估的一轮迭代：收集至多max_playouts个叶结点，统一评估后逐个扩展与回传。返回完成的Playout数。
+    size_t batchedPlayout(Board& board, Policy& policy, size_t max_playouts);
+
+    // 根据策略是否提供批量评估函数，执行一轮普通或批量的迭代。返回完成的Playout数。
+    size_t iterate(Board& board, Policy& policy, size_t max_playouts);
+
+    // 从根结点选择至叶结点，并在棋盘上落下沿途各手。启用置换表时，同时将沿途各手计入局面哈希
+    Node* descend(Board& board, Policy& policy, SymmetricHash& hash);
+
+    // 评估叶结点局面。启用置换表时优先查表，未命中再调用simulate并写入表中
+    Policy::EvalResult evaluate(Board& board, Policy& policy, const SymmetricHash& hash);
+
+    // 以评估所得的概率扩展叶结点。树并行搜索时，该结点可能已被其他线程扩展；内存达到上限时则不再扩展。返回新增的结点数
+    size_t expand(Node* node, Board& board, Policy& policy, const Eigen::VectorXf& action_probs);
 
     void runPlayouts(Board& board);
 
+    // 多线程共享同一棵树进行搜索
+    void runParallelPlayouts(Board& board);
+
+    // 按时间控制搜索时，判断自start起完成iterations次Playout后是否应结束
+    bool timeUp(TimeManager::Clock::time_point start, size_t iterations);
+
+    // 构造函数的公共部分
+    void initialize(Position last_move, Player last_player, size_t c_threads);
+
+    // 后台搜索线程的主循环
+    void ponder(Board board);
+
+    // 搜索前回收内存：超出上限的一半时，逐轮折叠访问次数较少的子树，再将剩余的内存上限分给本轮搜索所用的内存池
+    void collectGarbage();
+
 public:
     std::shared_ptr<Policy> m_policy;
+    std::vector<std::shared_ptr<Policy>> m_workers; // 树并行搜索时各线程所用的策略副本
+    std::unique_ptr<NodePool> m_pool; // 必须先于m_root声明，以保证树销毁时内存池仍然有效
+    std::vector<std::unique_ptr<NodePool>> m_workerPools; // 各线程扩展结点所用的内存池
+    std::unique_ptr<Reclaimer> m_reclaimer; // 异步回收时所用的回收线程，首次推进根结点时创建。须声明于内存池与m_root之间
     std::unique_ptr<Node> m_root;
-    size_t m_size; // FIXME: 由于unique_ptr的自动销毁，目前暂不能正确计数。
+    std::vector<std::unique_ptr<Node>> m_history; // 根结点的祖先，由远及近。各祖先中通往下一层的子结点位置留空
+    std::shared_ptr<TranspositionTable> m_table; // 缓存叶结点评估结果的置换表，为空时不启用。可在多棵树间共享
+    SymmetricHash m_rootHash; // 根结点局面的对称哈希，仅在启用置换表时维护
+    size_t m_size; // 树中存活的结点数，由内存池计数
+    size_t m_memory = 0; // 树中结点与子结点数组所占的字节数，由内存池计数
+    size_t c_memoryLimit = C_MEMORY_LIMIT; // 内存上限。达到上限后不再扩展新结点，只继续细化已有结点的统计量
+    bool c_asyncReclaim = false; // 推进根结点时是否在后台销毁被丢弃的子树。此时m_size与m_memory包含尚未销毁的结点
+    size_t c_historyDepth = 0; // 推进根结点时保留的祖先层数，为0时不保留。祖先的其余子树计入m_size与m_memory，内存紧张时最先丢弃
+    size_t m_depth; // 根结点局面的手数。构造时只给出最后一手则未知（SIZE_MAX），待首次同步时按棋谱定位
+    std::uint64_t m_rootKey; // 根结点局面的Zobrist哈希（同TranspositionTable::Hash），与棋谱各前缀比对以定位根结点
     size_t m_iterations;
     milliseconds m_duration;
+    std::shared_ptr<TimeManager> m_timer; // 按时间控制搜索时所用的时间管理，为空时每步固定搜索m_duration
+    SearchStats m_stats; // 上一轮搜索的统计（各线程之和）
+    bool c_profile = false; // 是否为搜索的各阶段计时
+    size_t m_ponderIterations = 0; // 上一次后台搜索完成的Playout数，停止后有效
+    Position m_provenMove = Position::npos; // 上一轮搜索中策略证明的根局面必胜手，为npos时表示未证明
 
 private:
     enum class Constraint {
         Iterations, Duration
     } c_constraint;
+
+    std::atomic<bool> m_pondering{ false };
+    std::thread m_ponderer;
+};
+
+
+// 根并行（集成）的蒙特卡洛树搜索。
+// 多棵树在各自的线程上独立搜索，每棵树使用一份策略副本；决策前合并各树根结点的子结点统计量。
+// 相比树并行，线程间无需任何同步，代价是单棵树的搜索深度不会增加。
+class EnsembleMCTS {
+public:
+    // 通过时间控制模拟迭代。
+    EnsembleMCTS(
+        milliseconds c_duration  = C_DURATION,
+        Position     last_move   = -1,
+        Player       last_player = Player::White,
+        std::shared_ptr<Policy> policy = nullptr,
+        size_t       c_trees     = 2
+    );
+
+    // 通过次数控制模拟迭代。每棵树各迭代c_iterations次。
+    EnsembleMCTS(
+        size_t   c_iterations,
+        Position last_move   = -1,
+        Player   last_player = Player::White,
+        std::shared_ptr<Policy> policy = nullptr,
+        size_t   c_trees     = 2
+    );
+
+    Position getAction(Board& board);
+    Policy::EvalResult evalState(Board& board); // 基于合并后访问次数的评估函数
+
+    // 合并各树根结点的子结点统计量：<各位置的访问次数之和, 各位置按访问次数加权的价值, 根结点的加权价值>
+    std::tuple<Eigen::VectorXf, Eigen::VectorXf, float> mergeRoots() const;
+
+    void syncWithBoard(Board& board);
+    void reset();
+
+private:
+    void runPlayouts(Board& board);
+
+public:
+    std::vector<std::unique_ptr<MCTS>> m_trees; // 首棵树使用传入的策略，其余使用其副本
+    size_t m_size; // 各树结点数之和
+    size_t m_iterations; // 各树迭代次数之和
+    milliseconds m_duration;
 };
 
 }
@@ -51,6 +51,54 @@ constexpr int EncodeCharset(char ch) {
 constexpr int Codeset[] = { 1, 2, 3, 4 };
 
 
+// 8ֶԳƱ任µZobristϣά
+// hashes[s]Ϊ̾BoardHash::Transform(, s)任Ĺϣhashes[0]BoardMap::m_hash
+struct SymmetricHash {
+	static constexpr int Size = 8;
+
+	SymmetricHash(); // ̵Ĺϣ
+
+	explicit SymmetricHash(const Board& board);
+
+	// pose»򳷻playerһӣ߾Ϊͬһ
+	void toggle(Position pose, Player player);
+
+	// 淶ϣ任СĹϣΪԳƵľ湲ôֵ
+	std::uint64_t canonical() const;
+
+	// ȡù淶ϣı任ΪԳƵľ澭Եĸñ任õͬһ
+	int symmetry() const;
+
+	bool operator==(const SymmetricHash& other) const { return hashes == other.hashes; }
+
+	std::array<std::uint64_t, Size> hashes;
+};
+
+
+// ƽ棬Ϊ[X_t, Y_t, Z_t, y_t-1, x_t-2, C<is_black>]ͬSample::statesmodel_keras.pyά
+// ƽ水ڡסյľɫ洢ȡʱٰǰУÿֻĶֽڡ
+struct FeaturePlanes {
+	static constexpr int Planes = 6;
+
+	FeaturePlanes(); // 
+
+	explicit FeaturePlanes(const Board& board);
+
+	// playermoveӣrecordΪǰ
+	void applyMove(Position move, Player player, const std::vector<Position>& record);
+
+	// playermoveһӣrecordΪغ
+	void revertMove(Position move, Player player, const std::vector<Position>& record);
+
+	// ԵǰҵӽдPlanes * BOARD_SIZEֽڣֱӿ
+	void copyTo(std::uint8_t* states) const;
+
+	// סաڣ±ͬBoard::m_moveStatesһ֡ƽ
+	std::array<std::array<std::uint8_t, BOARD_SIZE>, Planes - 1> m_planes;
+	Player m_curPlayer; // վֺ԰ִν
+};
+
+
 class BoardMap {
 public:
 	static std::tuple<int, int> ParseIndex(Position pose, Direction direction);
@@ -69,17 +117,60 @@ public:
 	std::unique_ptr<Board> m_board;
 	std::array<std::string, 3 * (WIDTH + HEIGHT) - 2> m_lineMap;
 	std::uint64_t m_hash;
+	SymmetricHash m_symmetry;
+	FeaturePlanes m_features;
 };
 
 
+// ZobristӡڱSplitMix64ɣƽ̨һ£־û
+constexpr std::uint64_t C_ZOBRIST_SEED = 0x9E3779B97F4A7C15ull;
+
+// SplitMix64αһ
+constexpr std::uint64_t SplitMix64(std::uint64_t& state) {
+	std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
 struct BoardHash {
 	// Zobristϣ洢//״̬
-	static const std::array<std::uint64_t[3], BOARD_SIZE> Zorbrist;
+	static constexpr std::array<std::array<std::uint64_t, 3>, BOARD_SIZE> Zorbrist = []() {
+		std::array<std::array<std::uint64_t, 3>, BOARD_SIZE> keys{};
+		std::uint64_t state = C_ZOBRIST_SEED;
+		for (auto& key : keys) {
+			for (auto& value : key) {
+				value = SplitMix64(state);
+			}
+		}
+		return keys;
+	}();
 	
 	static std::uint64_t HashPose(Position pose, Player player) {
 		return Zorbrist[pose.id][static_cast<int>(player) + 1];
 	}
 
+	// symmetryֶԳƱ任bit2ΪԽ߷תxybit0תxbit1תy
+	static constexpr Position Transform(Position pose, int symmetry) {
+		static_assert(WIDTH == HEIGHT, "board symmetries require a square board");
+		int x = pose.x(), y = pose.y();
+		if (symmetry & 4) {
+			int t = x; x = y; y = t;
+		}
+		if (symmetry & 1) {
+			x = WIDTH - 1 - x;
+		}
+		if (symmetry & 2) {
+			y = HEIGHT - 1 - y;
+		}
+		return { x, y };
+	}
+
+	// symmetryֱ任任ȷת󻥻xyȼȻ󽻻תλ
+	static constexpr int Inverse(int symmetry) {
+		return symmetry & 4 ? 4 | (symmetry & 1) << 1 | (symmetry & 2) >> 1 : symmetry;
+	}
+
 	// WARNING: 64λ뻷sizeof(size_t)Ϊ64λ
 	std::size_t operator()(const BoardMap& boardMap) {
 		return boardMap.m_hash;
@@ -87,6 +178,28 @@ struct BoardHash {
 };
 
 
+inline void SymmetricHash::toggle(Position pose, Player player) {
+	for (int s = 0; s < Size; ++s) {
+		auto transformed = BoardHash::Transform(pose, s);
+		hashes[s] ^= BoardHash::HashPose(transformed, Player::None) ^ BoardHash::HashPose(transformed, player);
+	}
+}
+
+inline std::uint64_t SymmetricHash::canonical() const {
+	return hashes[symmetry()];
+}
+
+inline int SymmetricHash::symmetry() const {
+	int best = 0;
+	for (int s = 1; s < Size; ++s) {
+		if (hashes[s] < hashes[best]) {
+			best = s;
+		}
+	}
+	return best;
+}
+
+
 }
 
 namespace std {
@@ -0,0 +1,69 @@
+#ifndef GOMOKU_NETWORK_H_
+#define GOMOKU_NETWORK_H_
+#include "MCTS.h"      // Gomoku::Policy::EvalResult
+#include <string>      // std::string
+#include <vector>      // std::vector
+#include <cstdint>     // std::uint8_t
+
+namespace Gomoku {
+
+/*
+    纯推理的策略价值网络，与network/model_keras.py中的PolicyValueNetwork结构一致：
+    ① 共享的卷积主干之后分出价值头与策略头，各头由1x1卷积、展平后的全连接层组成。
+    ② 权重由PolicyValueNetwork.export_native离线导出，批归一化已折叠进卷积的权重与偏置。
+    ③ 卷积以im2col展开后同一批局面做一次矩阵乘法，前向传播不修改任何状态，可被多个线程共用。
+*/
+class PolicyValueNetwork {
+public:
+    enum class Activation : std::uint8_t { None, ReLU, Tanh, Softmax };
+
+    // 权重在文件中的存储精度。载入后一律还原为float计算，低精度只用于缩小文件与映射的体积
+    enum class Precision : std::uint8_t {
+        Float32,
+        Float16,
+        Int8     // 每个输出通道一个缩放系数的对称量化
+    };
+
+    struct Layer {
+        int kernel;                // 卷积核边长（same填充），0表示全连接层
+        int inputs;                // 输入通道数，全连接层为输入特征数
+        int outputs;               // 输出通道数或特征数
+        Activation activation;
+        Eigen::MatrixXf weights;   // outputs x (inputs * kernel * kernel)，列按 (输入通道, 核y, 核x) 排列
+        Eigen::VectorXf bias;
+    };
+
+public:
+    PolicyValueNetwork() = default;
+
+    // 载入path处导出的权重。文件不存在、格式、棋盘尺寸或结构不符时抛出std::runtime_error
+    explicit PolicyValueNetwork(const std::string& path);
+
+    // 以precision精度保存权重。结构不合法时抛出std::invalid_argument，无法写入时抛出std::runtime_error
+    void save(const std::string& path, Precision precision = Precision::Float32) const;
+
+    // 评估一个局面，返回 <相对于当前玩家的价值, 各处落子的概率>
+    Policy::EvalResult evaluate(const Board& board) const;
+
+    // 一次前向传播评估一批局面，结果与输入一一对应
+    std::vector<Policy::EvalResult> evaluate(const std::vector<Board>& boards) const;
+
+    // 评估batch个已编码的局面，states依次为各局面的Sample::Planes * BOARD_SIZE字节（同FeaturePlanes::copyTo的输出）
+    std::vector<Policy::EvalResult> evaluate(const std::uint8_t* states, std::size_t batch) const;
+
+    // 检查各层的尺寸能否首尾相接，且输入输出与棋盘尺寸相符。不合法时抛出std::invalid_argument
+    void validate() const;
+
+private:
+    // 对batch个局面的特征平面（(batch * BOARD_SIZE) x Planes）做前向传播
+    std::vector<Policy::EvalResult> forward(const Eigen::MatrixXf& input, std::size_t batch) const;
+
+public:
+    std::vector<Layer> m_trunk;      // 共享的卷积主干
+    std::vector<Layer> m_valueHead;  // 最后一层输出1个特征
+    std::vector<Layer> m_policyHead; // 最后一层输出BOARD_SIZE个特征
+};
+
+}
+
+#endif // !GOMOKU_NETWORK_H_
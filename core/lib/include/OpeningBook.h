@@ -0,0 +1,69 @@
+#ifndef GOMOKU_OPENING_BOOK_H_
+#define GOMOKU_OPENING_BOOK_H_
+#include "MCTS.h"      // Gomoku::MCTS, Gomoku::Policy
+#include "Mapping.h"   // Gomoku::SymmetricHash
+#include <memory>      // std::unique_ptr, std::shared_ptr
+#include <string>      // std::string
+#include <vector>      // std::vector
+#include <cstdint>     // std::uint64_t, std::uint32_t, std::uint16_t
+
+namespace Gomoku {
+
+inline namespace Config {
+    // 开局库生成的默认配置
+    constexpr int C_BOOK_PLIES = 4; // 收录的局面至多已落的手数
+    constexpr std::size_t C_BOOK_WIDTH = 2; // 每个局面收录访问次数最多的着法数，亦即向下展开的分支数
+    constexpr std::size_t C_BOOK_ITERATIONS = 100000; // 每个局面的MCTS迭代次数
+}
+
+class MappedFile;
+
+/*
+    开局库：离线以深度MCTS搜索开局的各局面，记录根结点访问次数最多的若干手，对局时直接查表落子。
+    ① 局面以规范哈希（SymmetricHash::canonical）为键，着法按规范变换存储，互为对称的局面共用表项。
+    ② 文件为定长表头加按键排序的定长表项，以内存映射载入，查询为二分查找，无需解析与拷贝。
+       表头记录生成时所用的Zobrist键（以空棋盘的哈希为指纹），与当前进程不一致时拒绝载入。
+*/
+class OpeningBook {
+public:
+    struct Entry {
+        std::uint64_t key;    // 局面的规范哈希
+        std::uint16_t move;   // 规范变换下的着法
+        std::uint16_t unused; // 对齐填充
+        std::uint32_t visits; // 该着法在根结点的访问次数
+    };
+
+    OpeningBook(); // 空的开局库，任何局面均查询不到
+
+    // 映射path处的开局库。文件不存在、格式或Zobrist键不符时抛出std::runtime_error
+    explicit OpeningBook(const std::string& path);
+
+    ~OpeningBook();
+
+    // 局面在库中访问次数最多的着法，未收录时返回npos
+    Position lookup(const Board& board) const;
+
+    std::size_t size() const { return m_size; } // 表项数
+
+public:
+    // 自空棋盘起逐层展开，以policy对每个未收录的局面进行iterations次迭代的MCTS搜索，
+    // 收录访问次数最多的width手，并沿这些着法继续展开，直至局面已落plies手
+    static std::vector<Entry> Generate(
+        std::shared_ptr<Policy> policy,
+        std::size_t iterations = C_BOOK_ITERATIONS,
+        int         plies      = C_BOOK_PLIES,
+        std::size_t width      = C_BOOK_WIDTH
+    );
+
+    // 将表项排序后写入path。无法写入时抛出std::runtime_error
+    static void Write(const std::string& path, std::vector<Entry> entries);
+
+private:
+    std::unique_ptr<MappedFile> m_file;
+    const Entry* m_entries = nullptr;
+    std::size_t m_size = 0;
+};
+
+}
+
+#endif // !GOMOKU_OPENING_BOOK_H_
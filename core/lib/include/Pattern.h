@@ -1,8 +1,15 @@
 #ifndef GOMOKU_PATTERN_MATCHING_H_
 #define GOMOKU_PATTERN_MATCHING_H_
 #include "Mapping.h"
+#include <deque>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace Gomoku {
 
@@ -15,6 +22,100 @@ enum PatternConfig {
 };
 }
 
+// Evaluator是否默认开启一致性检查。未指定时仅在调试构建（未定义NDEBUG）中开启。
+#ifndef GOMOKU_CHECKED_EVALUATOR
+#ifdef NDEBUG
+#define GOMOKU_CHECKED_EVALUATOR 0
+#else
+#define GOMOKU_CHECKED_EVALUATOR 1
+#endif
+#endif
+
+
+// 容量固定、元素内联存储的顺序容器。元素可以不可默认构造或不可赋值（如含引用成员），且永不搬移。
+// 用于Evaluator更新过程中的临时结果，使落子与悔棋不发生堆分配。
+template <typename T, std::size_t Capacity>
+class FixedVector {
+public:
+    FixedVector() = default;
+    FixedVector(const FixedVector&) = delete;
+    FixedVector& operator=(const FixedVector&) = delete;
+    ~FixedVector() { clear(); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (m_size == Capacity) {
+            throw std::length_error("FixedVector capacity exceeded");
+        }
+        return *new (&m_storage[m_size++]) T(std::forward<Args>(args)...);
+    }
+
+    void clear() {
+        for (auto& element : *this) {
+            element.~T();
+        }
+        m_size = 0;
+    }
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    T* begin() { return std::launder(reinterpret_cast<T*>(m_storage)); }
+    T* end()   { return begin() + m_size; }
+    const T* begin() const { return std::launder(reinterpret_cast<const T*>(m_storage)); }
+    const T* end()   const { return begin() + m_size; }
+
+    T& operator[](std::size_t i) { return begin()[i]; }
+    const T& operator[](std::size_t i) const { return begin()[i]; }
+    T& back() { return begin()[m_size - 1]; }
+
+private:
+    std::aligned_storage_t<sizeof(T), alignof(T)> m_storage[Capacity];
+    std::size_t m_size = 0;
+};
+
+
+// 棋盘位置的稀疏集合：m_items的前size()项为集合内的位置（顺序任意），m_indices为各位置在其中的下标。
+// 插入、删除、查询与清空均为O(1)，遍历只涉及集合内的位置。状态均为定长数组，可直接拷贝。
+class PositionSet {
+public:
+    bool contains(Position pose) const {
+        const auto index = m_indices[pose];
+        return index < m_size && m_items[index] == pose.id;
+    }
+
+    void insert(Position pose) {
+        if (!contains(pose)) {
+            m_indices[pose] = CellIndex(m_size);
+            m_items[m_size++] = CellIndex(pose.id);
+        }
+    }
+
+    void erase(Position pose) {
+        if (contains(pose)) {
+            const auto index = m_indices[pose], last = m_items[--m_size];
+            m_items[index] = last;
+            m_indices[last] = index;
+        }
+    }
+
+    // 按member插入或删除pose
+    void assign(Position pose, bool member) { member ? insert(pose) : erase(pose); }
+
+    void clear() { m_size = 0; }
+
+    int size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    const CellIndex* begin() const { return m_items.data(); }
+    const CellIndex* end()   const { return m_items.data() + m_size; }
+
+private:
+    std::array<CellIndex, BOARD_SIZE> m_items = {};
+    std::array<CellIndex, BOARD_SIZE> m_indices = {};
+    int m_size = 0;
+};
+
 
 struct Pattern {
     /*
@@ -23,8 +124,9 @@ struct Pattern {
           '_': 对该棋型所属玩家来说有利的空位
           '^': 该棋型敌对玩家可用于反击的空位
           '~': 对双方玩家均无价值，但对该棋型而言必须存在的空位
+        str只是视图：原型须为字符串字面量等静态存储的字符串，增强得到的模式串由AhoCorasickBuilder持有，随搜索器转移。
     */
-    std::string str;
+    std::string_view str;
 
     // 表明该模式对何方有利
     Player favour;
@@ -42,7 +144,8 @@ struct Pattern {
     int score;
 
     // proto中的第一个字符为'+'或'-'，分别代表对黑棋与白棋有利。
-    Pattern(std::string_view proto, Type type, int score);
+    constexpr Pattern(std::string_view proto, Type type, int score)
+        : str(proto.substr(1)), favour(proto[0] == '+' ? Player::Black : Player::White), type(type), score(score) { }
 };
 
 
@@ -54,13 +157,19 @@ public:
     // 一条匹配记录包含了{ 匹配到的模式, 相对于起始位置的偏移 }
     using Entry = std::tuple<const Pattern&, int>;
 
+    // 查找表中同一窗口末位上至多结尾的模式数，由buildLookupTable检查
+    static constexpr int MaxWindowMatches = 2;
+
+    // 覆盖中心点的模式结尾于中心点起的MAX_PATTERN_LEN个位置之一，故lookup的结果数有此上界
+    using Entries = FixedVector<Entry, MAX_PATTERN_LEN * MaxWindowMatches>;
+
     // 验证entry是否覆盖了某个点位（以相对原点的偏移表示）。默认为TARGET_LEN/2，即中心点。
     static bool HasCovered(const Entry& entry, size_t pose = TARGET_LEN / 2);
 
     // 仿照Python生成器模式编写的用于返回匹配结果的工具类。
     struct generator {
         std::string_view target = "";
-        PatternSearch* ref = nullptr;
+        const PatternSearch* ref = nullptr;
         int offset = -1, state = 0;
 
         generator begin() { return state == 0 ? ++(*this) : *this; } // ++是为了保证从begin开始就有匹配结果。
@@ -78,19 +187,43 @@ public:
 
     // 构造函数中传入的模式原型将经过几层强化，获得完整的模式表。
     PatternSearch(std::initializer_list<Pattern> protos);
+
+    // 直接引用生成的静态表（见AhoCorasickBuilder::Emit），无需构建，可在编译期完成初始化。
+    constexpr PatternSearch(const int* base, const int* check, const int* fail, const int* invariants,
+                            const Pattern* patterns, const int* windowFirst, const int* windowPatterns)
+        : m_base(base), m_check(check), m_fail(fail), m_invariants(invariants),
+          m_patterns(patterns), m_windowFirst(windowFirst), m_windowPatterns(windowPatterns) { }
     
     // 返回一个生成器，每一次解引用返回当前匹配到的模式，并移动到下一个模式。
-    generator execute(std::string_view target);
+    generator execute(std::string_view target) const;
 
     // 一次性直接返回所有查找到的记录。
-    std::vector<Entry> matches(std::string_view target);
+    std::vector<Entry> matches(std::string_view target) const;
+
+    // 查表求出长为TARGET_LEN的target中所有覆盖了中心点的记录，追加至entries末尾。
+    // 记录按结尾偏移升序排列，同一结尾处按模式长度降序排列。
+    void lookup(std::string_view target, Entries& entries) const;
+
+    // 查找表以MAX_PATTERN_LEN个棋位为窗口，每位占2比特
+    static constexpr int WindowBits = 2 * MAX_PATTERN_LEN;
 
 private:
-    std::vector<int> m_base;  // DAT子结点基准数组
-    std::vector<int> m_check; // DAT父结点检索数组
-    std::vector<int> m_fail;  // AC自动机fail指针数组
-    std::vector<int> m_invariants;   // AC自动机「不动点」状态数组
-    std::vector<Pattern> m_patterns; // 可检索模式集合
+    // 运行时构建的搜索器所用的存储，由AhoCorasickBuilder填充，各阶段完成后令下方的数组指向其中
+    struct Storage {
+        std::vector<int> base, check, fail, invariants, windowFirst, windowPatterns;
+        std::vector<Pattern> patterns;
+        std::deque<std::string> strings; // 增强所得的模式串，deque在增长与交换时不移动元素，故视图始终有效
+    };
+
+private:
+    const int* m_base = nullptr;  // DAT子结点基准数组
+    const int* m_check = nullptr; // DAT父结点检索数组
+    const int* m_fail = nullptr;  // AC自动机fail指针数组
+    const int* m_invariants = nullptr;   // AC自动机「不动点」状态数组
+    const Pattern* m_patterns = nullptr; // 可检索模式集合
+    const int* m_windowFirst = nullptr;    // 查找表：各窗口在m_windowPatterns中的起始下标
+    const int* m_windowPatterns = nullptr; // 查找表：以窗口末位结尾的模式下标
+    std::unique_ptr<Storage> m_storage; // 由生成的静态表构造时为空
 };
 
 
@@ -112,8 +245,8 @@ struct Compound {
     // 表明该复合模式对何方有利
     Player favour;
 
-    // 记录构成复合模式的各单个模式，及它们所在方向
-    std::vector<Component> components;
+    // 记录构成复合模式的各单个模式，及它们所在方向。每个方向至多记录两个同类模式。
+    FixedVector<Component, 2 * std::size(Directions)> components;
 
     // 记录该复合模式的类型
     enum Type { DoubleThree, FourThree, DoubleFour, Size } type;
@@ -160,15 +293,58 @@ public:
         return (favour == Player::Black) << 1 | (perspective == Player::Black);
     }
 
-    // 基于AC自动机实现的多模式匹配器。
-    static PatternSearch Patterns;
-
-    // 基于Eigen向量化操作与Map引用实现的区域棋子密度计数器，tuple组成: { 权重， 分数 }。
-    static std::tuple<Eigen::Array<int, BLOCK_SIZE, BLOCK_SIZE, Eigen::RowMajor>, int> BlockWeights;
+    // 模式原型，由AhoCorasickBuilder增强为完整的模式表
+    static const std::initializer_list<Pattern> Prototypes;
+
+    // 基于AC自动机实现的多模式匹配器。由Prototypes离线生成的静态表构成，无需在程序启动时构建。
+    static const PatternSearch Patterns;
+
+    // 是否在每次更新后检查分数与棋盘的一致性（O(BOARD_SIZE)），不一致时抛出std::logic_error。
+    // 默认值由GOMOKU_CHECKED_EVALUATOR决定，测试中应始终开启。须在搜索开始前设置。
+    static inline bool Checked = GOMOKU_CHECKED_EVALUATOR;
+
+    // 基于Eigen向量化操作与Map引用实现的区域棋子密度计数器的权重与分数。
+    static constexpr int BlockWeights[BLOCK_SIZE][BLOCK_SIZE] = {
+        { 2, 0, 0, 1, 0, 0, 2 },
+        { 0, 4, 3, 3, 3, 4, 0 },
+        { 0, 3, 5, 4, 5, 3, 0 },
+        { 1, 3, 4, 0, 4, 3, 1 },
+        { 0, 3, 5, 4, 5, 3, 0 },
+        { 0, 4, 3, 3, 3, 4, 0 },
+        { 2, 0, 0, 1, 0, 0, 2 },
+    };
+    static constexpr int BlockScore = 160;
 
     template<size_t Size>
     using Distribution = std::array<std::array<Record, Size>, BOARD_SIZE + 1>; // 最后一个元素用于总计数
 
+    using Density = Eigen::Array<int, BOARD_SIZE, 1>;
+    using Scores = Eigen::Matrix<int, BOARD_SIZE, 1>;
+
+    // 随分布增量维护的各类型位置集合，使启发式只需遍历有对应棋型的少数空位。
+    // 更新时只标记变化过的位置，到查询该类型时才重新归类，故多次落子与悔棋中反复变化的位置只归类一次。
+    struct Index {
+        PositionSet patterns[Pattern::Size - 1]; // 各棋型在其上有记录的位置
+        PositionSet compounds[Compound::Size]; // 各复合模式在其上有记录的位置
+        Bitboard patternDirty[Pattern::Size - 1]; // 分布变化后尚未重新归类的位置
+        Bitboard compoundDirty[Compound::Size];
+    };
+
+    // 评估器的完整状态。除棋盘的落子记录外均为定长数组，保存与恢复只是O(状态大小)的拷贝，与手数及模式匹配无关。
+    // 拷贝时复用已有的容器空间，因此反复恢复同一快照不会发生堆分配。
+    struct Snapshot {
+        Board board;
+        decltype(BoardMap::m_lineMap) lineMap;
+        std::uint64_t hash;
+        SymmetricHash symmetry;
+        FeaturePlanes features;
+        Distribution<Pattern::Size - 1> patternDist;
+        Distribution<Compound::Size> compoundDist;
+        Density density[2][2];
+        Scores scores[4];
+        Index index;
+    };
+
 public:
     explicit Evaluator(Board* board = nullptr);
 
@@ -178,6 +354,11 @@ public:
 
     auto& density(Player player) { return m_density[Group(player)]; }
 
+    // 在其上有该类型记录的空位，顺序任意
+    const PositionSet& positions(Pattern::Type type);
+
+    const PositionSet& positions(Compound::Type type);
+
     Player applyMove(Position move);
 
     Player revertMove(size_t count = 1);
@@ -186,9 +367,21 @@ public:
 
     void syncWithBoard(const Board& board); // 同步Evaluator至传入的Board状态。
 
+    // 同上。若base的局面是board的前缀，且从base重放比逐手悔棋重放更快，则先恢复至base再同步。
+    void syncWithBoard(const Board& board, const Snapshot& base);
+
+    void save(Snapshot& snapshot) const; // 将当前状态保存至snapshot。
+
+    void restore(const Snapshot& snapshot); // 恢复至snapshot保存的状态。
+
     void reset();
 
+    // 检查已落子格点的分数均为0、空位的分数均非负，且位置集合与分布一致。
+    void checkInvariants();
+
 private:
+    friend struct Compound;
+
     class Updater {
     public:
         explicit Updater(Evaluator& ev) : ev(ev) { }
@@ -201,22 +394,27 @@ private:
         void updateBlock(int delta, Player src_player);
         auto& matchResults(int delta, Direction dir) { return results[delta == 1][int(dir)]; }
         Compound* findCompound(Position pose, Player player);
+        static int CompoundKey(Position pose, Player player) { return 2 * pose + Group(player); }
     private:
         int delta; // 变化量，取值为 { 1, -1 }
         Position move; // 更新的中心位置
 		Player player; // 更新的源玩家（Player::None代表悔棋）
         Evaluator& ev; // 原Evaluator的引用
-        std::vector<PatternSearch::Entry> results[2][4]; // 存储单模式匹配结果
-        std::vector<std::tuple<Position, Player>> compound_keys; // 复合模式索引
-        std::vector<Compound> compounds; // 待更新复合模式集合
+        PatternSearch::Entries results[2][4]; // 存储单模式匹配结果
+        // 待更新复合模式集合。每个方向的线视图上，双方各在至多TARGET_LEN个空位上检测复合模式
+        FixedVector<Compound, 2 * std::size(Directions) * TARGET_LEN> compounds;
+        std::array<std::uint8_t, 2 * BOARD_SIZE> compound_index = {}; // 复合模式索引，以CompoundKey定位，存储compounds下标 + 1，0表示不存在
     } m_updater;
 
 public:
     BoardMap m_boardMap; // 内部维护了一个Board, 避免受到外部的干扰
     Distribution<Pattern::Size - 1> m_patternDist; // 不统计Pattern::Five分布
     Distribution<Compound::Size> m_compoundDist;
-    Eigen::ArrayXi m_density[2][2]; // 第一维: { White, Black }, 第二维: { Σ1, Σweight }
-    Eigen::VectorXi m_scores[4]; // 按照Group函数分组
+    Density m_density[2][2]; // 第一维: { White, Black }, 第二维: { Σ1, Σweight }
+    Scores m_scores[4]; // 按照Group函数分组
+    Index m_index;
+    std::size_t m_applies = 0; // 累计增量更新的落子手数，不随快照恢复，供搜索统计使用
+    std::size_t m_reverts = 0; // 累计增量更新的悔棋手数
 };
 
 }
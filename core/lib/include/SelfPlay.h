@@ -0,0 +1,111 @@
+#ifndef GOMOKU_SELF_PLAY_H_
+#define GOMOKU_SELF_PLAY_H_
+#include "MCTS.h"      // Gomoku::MCTS, Gomoku::Policy
+#include <array>       // std::array
+#include <fstream>     // std::ofstream
+#include <functional>  // std::function
+#include <memory>      // std::shared_ptr
+#include <string>      // std::string
+#include <vector>      // std::vector
+#include <cstdint>     // std::uint8_t, std::uint64_t
+
+namespace Gomoku {
+
+inline namespace Config {
+    // 自对弈的默认配置
+    constexpr std::size_t C_SELFPLAY_ITERATIONS = 1000; // 每步的MCTS迭代次数
+}
+
+// 一个训练样本，与Python端Board.encoded_states及dual_play的输出一一对应
+struct Sample {
+    static constexpr int Planes = FeaturePlanes::Planes;
+
+    std::array<std::uint8_t, Planes * BOARD_SIZE> states; // 特征平面[X_t, Y_t, Z_t, y_t-1, x_t-2, C<is_black>]，先y再x
+    float value; // 终局结果相对于当前玩家的得分
+    std::array<float, BOARD_SIZE> probs; // 搜索给出的落子概率
+
+    // 将board的Planes个特征平面写入states（Planes * BOARD_SIZE字节），供网络输入与样本共用
+    static void EncodeStates(const Board& board, std::uint8_t* states);
+
+    // 编码board的特征平面，value待终局后填入
+    static Sample Encode(const Board& board, const Eigen::VectorXf& probs);
+
+    // 第symmetry种对称变换（见BoardHash::Transform）下的样本
+    Sample transformed(int symmetry) const;
+};
+
+
+/*
+    样本分片文件：定长表头后紧跟count个Sample，按其内存布局原样存储，可直接以numpy的结构化dtype映射。
+    写入时先占位表头，样本随对局结束流式追加，close时回填样本数，因此中途中断的分片仍可读出已完成的对局。
+*/
+class ShardWriter {
+public:
+    // 无法写入path时抛出std::runtime_error
+    explicit ShardWriter(const std::string& path);
+
+    ~ShardWriter(); // 未close时自动回填
+
+    void write(const std::vector<Sample>& samples);
+    void close();
+
+    std::size_t size() const { return m_count; } // 已写入的样本数
+
+    // 读出分片中的全部样本。文件不存在、格式或棋盘尺寸不符时抛出std::runtime_error
+    static std::vector<Sample> Read(const std::string& path);
+
+private:
+    std::ofstream m_ofs;
+    std::size_t m_count = 0;
+};
+
+
+// 一个局面的搜索结果
+struct SearchResult {
+    Position move;         // 搜索选出的着法，同MCTS::getAction
+    float value;           // 根结点的价值
+    Eigen::VectorXf probs; // 落子概率，同MCTS::evalState
+};
+
+
+/*
+    原生的自对弈数据生成器：c_workers个线程并行对局，每局由一棵MCTS执黑白双方，
+    每步按evalState的概率（前期温度为1，其后近似取最大值）抽样落子，终局后为各步样本填入得分，
+    并可做8倍的对称增强。各线程使用策略原型的一份副本，因此c_workers > 1时要求策略支持clone()。
+    policy为空时使用RandomPolicy。
+*/
+class SelfPlay {
+public:
+    SelfPlay(
+        std::shared_ptr<Policy> policy,
+        std::size_t c_iterations = C_SELFPLAY_ITERATIONS,
+        std::size_t c_workers    = 1
+    );
+
+    // 进行games局对局，每局结束后将该局的样本交给sink（已加锁，同一时刻只有一个线程调用）
+    void play(std::size_t games, const std::function<void(std::vector<Sample>&)>& sink);
+
+    // 进行games局对局，返回全部样本
+    std::vector<Sample> play(std::size_t games);
+
+    // 以同样的配置并行搜索多个互不相关的局面（如评测对局中各盘的当前局面），按输入顺序返回结果。已结束的局面返回npos
+    std::vector<SearchResult> search(const std::vector<Board>& boards) const;
+
+private:
+    // 在一棵新的树上下完一局，返回各步的样本
+    std::vector<Sample> playGame(const std::shared_ptr<Policy>& policy) const;
+
+    // 由c_workers个线程分担count个任务，task(i, policy)以所在线程的策略副本执行第i个任务。
+    // 任一任务抛出异常后，其余线程完成手上的任务即退出，异常在所有线程结束后重新抛出
+    void parallelFor(std::size_t count, const std::function<void(std::size_t, const std::shared_ptr<Policy>&)>& task) const;
+
+public:
+    std::shared_ptr<Policy> m_policy;
+    std::size_t c_iterations;
+    std::size_t c_workers;
+    bool c_augment = true; // 是否输出每个样本的8种对称变换
+};
+
+}
+
+#endif // !GOMOKU_SELF_PLAY_H_
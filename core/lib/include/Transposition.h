@@ -0,0 +1,165 @@
+#ifndef GOMOKU_TRANSPOSITION_H_
+#define GOMOKU_TRANSPOSITION_H_
+#include "MCTS.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace Gomoku {
+
+/*
+    置换表：以局面的Zobrist哈希（与BoardMap::m_hash一致）为键，缓存Policy::simulate的评估结果。
+    ① 表的大小在构造时固定（向上取整为2的幂），键相撞时总是以新结果覆盖旧结果。
+    ② 每个表项以序列锁保护，读写均无需加锁，可被树并行的各线程共享。
+       读取时若遇到正在写入的表项，视为未命中；写入时若该表项正被其他线程写入，则放弃本次写入。
+    ③ 缓存的评估结果会被当作确定值重复使用，适合神经网络、局势评估等确定性的评估函数。
+       对随机模拟而言，命中意味着复用同一次模拟的结果。
+    ④ 以c_symmetric构造时，按SymmetricHash查询的局面以规范哈希为键，概率向量按规范变换存取，
+       互为对称的局面（如开局阶段经旋转、翻转得到的局面）共用同一表项。
+*/
+class TranspositionTable {
+public:
+    struct Stats {
+        std::size_t probes;     // 查询次数
+        std::size_t hits;       // 命中次数
+        std::size_t stores;     // 写入次数
+        std::size_t overwrites; // 覆盖了其他局面的写入次数
+    };
+
+    explicit TranspositionTable(std::size_t capacity = 1 << 16, bool c_symmetric = false);
+
+    // 查询局面的评估结果，未命中时返回空值
+    std::optional<Policy::EvalResult> probe(std::uint64_t hash);
+    std::optional<Policy::EvalResult> probe(const SymmetricHash& hash);
+
+    // 写入局面的评估结果。概率向量的长度应为BOARD_SIZE
+    void store(std::uint64_t hash, const Policy::EvalResult& result);
+    void store(const SymmetricHash& hash, const Policy::EvalResult& result);
+
+    // 清空所有表项与统计量
+    void clear();
+
+    Stats stats() const;
+    double hitRate() const; // 命中次数 / 查询次数
+    std::size_t capacity() const { return m_mask + 1; }
+
+public:
+    const bool c_symmetric; // 是否令对称的局面共用表项
+
+public:
+    // 计算棋盘的Zobrist哈希，即所有格点按其状态所取键值的异或
+    static std::uint64_t Hash(const Board& board);
+
+    // 在哈希中落下一子，返回新的哈希
+    static std::uint64_t HashMove(std::uint64_t hash, Position move, Player player);
+
+private:
+    // 表项存储的是局面经第symmetry种变换后的结果
+    std::optional<Policy::EvalResult> probe(std::uint64_t key, int symmetry);
+    void store(std::uint64_t key, int symmetry, const Policy::EvalResult& result);
+
+private:
+    struct Entry {
+        std::atomic<std::uint32_t> sequence; // 为奇数时表示正在写入
+        std::atomic<std::uint64_t> key;
+        std::atomic<float> value;
+        std::array<std::atomic<float>, BOARD_SIZE> probs;
+    };
+
+    std::unique_ptr<Entry[]> m_entries;
+    std::size_t m_mask;
+    std::atomic<std::size_t> m_probes = 0;
+    std::atomic<std::size_t> m_hits = 0;
+    std::atomic<std::size_t> m_stores = 0;
+    std::atomic<std::size_t> m_overwrites = 0;
+};
+
+
+inline namespace Config {
+    // 评估缓存的默认配置
+    constexpr std::size_t C_CACHE_MEMORY = 64 << 20; // 内存上限（字节）
+    constexpr std::size_t C_CACHE_SHARDS = 16; // 分片数，各分片独立加锁
+}
+
+/*
+    评估缓存：以规范哈希为键，缓存 <价值, 稀疏的先验概率>，供神经网络等开销大的评估函数跨回合、跨线程复用。
+    ① 与TranspositionTable的定长表项不同，表项只存储概率不为0的位置，大小随先验的集中程度变化，
+       总占用以估算的字节数计，超出上限时按LRU逐出最久未被访问的局面。
+    ② 键按哈希分散到若干分片，每个分片各有一把锁与一条LRU链表，上限在分片间均分。
+    ③ 以c_symmetric构造时，互为对称的局面共用表项，概率按规范变换存取（同TranspositionTable）。
+    ④ 网络的输入除棋子外还有最近两手的平面，因此键在规范哈希之外混入经同一规范变换的最近两手，
+       棋子相同而落子次序不同的局面各占一个表项。局面自身对称时，规范变换不唯一，等价的局面可能未命中，但不会误中。
+*/
+class EvaluationCache {
+public:
+    struct Stats {
+        std::size_t probes;    // 查询次数
+        std::size_t hits;      // 命中次数
+        std::size_t stores;    // 写入次数
+        std::size_t evictions; // 因超出内存上限而逐出的表项数
+    };
+
+    explicit EvaluationCache(std::size_t c_memory = C_CACHE_MEMORY, bool c_symmetric = true, std::size_t c_shards = C_CACHE_SHARDS);
+
+    // 查询局面的评估结果，命中时将其标记为最近使用，未命中时返回空值
+    std::optional<Policy::EvalResult> probe(const Board& board);
+
+    // 写入局面的评估结果（已存在时覆盖），必要时逐出最久未被访问的表项。单个表项超出分片上限时不写入
+    void store(const Board& board, const Policy::EvalResult& result);
+
+    // 清空所有表项与统计量
+    void clear();
+
+    Stats stats() const;
+    double hitRate() const; // 命中次数 / 查询次数
+    std::size_t size() const;   // 表项数
+    std::size_t memory() const; // 估算的占用字节数
+
+    // 一个含entries个非零先验的表项的估算大小，包括链表与索引的结点开销
+    static std::size_t EntrySize(std::size_t entries);
+
+public:
+    // 包装评估函数，只对未命中的局面调用evaluate并写入结果。
+    // 返回的函数持有cache的所有权，可直接作为Policy的simulate与simulateBatch
+    static Policy::EvalFunc Cached(std::shared_ptr<EvaluationCache> cache, Policy::EvalFunc evaluate);
+    static Policy::BatchEvalFunc Cached(std::shared_ptr<EvaluationCache> cache, Policy::BatchEvalFunc evaluate);
+
+public:
+    const std::size_t c_memory;
+    const bool c_symmetric;
+
+private:
+    struct Entry {
+        std::uint64_t key;
+        float value;
+        Policy::SparseProbs priors; // 规范变换下的位置
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> entries; // 表头为最近使用
+        std::unordered_map<std::uint64_t, std::list<Entry>::iterator> index;
+        std::size_t memory = 0;
+    };
+
+    Shard& shard(std::uint64_t key) { return m_shards[(key >> 32) % m_shards.size()]; }
+
+    // 局面的 <键, 存取概率所用的变换>，见④
+    std::pair<std::uint64_t, int> key(const Board& board) const;
+
+private:
+    std::vector<Shard> m_shards;
+    std::atomic<std::size_t> m_probes = 0;
+    std::atomic<std::size_t> m_hits = 0;
+    std::atomic<std::size_t> m_stores = 0;
+    std::atomic<std::size_t> m_evictions = 0;
+};
+
+}
+
+#endif // !GOMOKU_TRANSPOSITION_H_
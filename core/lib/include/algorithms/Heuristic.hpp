@@ -38,7 +38,7 @@ struct Heuristic {
     // weight = normalize(w/n * 1.5n/(0.5+n)) = normalize(3w/(1+2n))
     static Eigen::VectorXf DensityWeight(Evaluator& ev, Player player) {
         const auto filter = [](int x) { return std::max(x, 0); };
-        const auto [counts, weights] = ev.density(player);
+        const auto& [counts, weights] = ev.density(player);
         auto N = counts.unaryExpr(filter).cast<float>();
         auto W = weights.unaryExpr(filter).cast<float>();
         return ((3 * W) / (1 + 2 * N)).matrix().normalized();
@@ -49,7 +49,7 @@ struct Heuristic {
         auto init_player = board.m_curPlayer;
         auto total_moves = 0;
         for (int i = 0; i < c_rollouts; ++i) {
-            auto [winner, total_moves] = Default::RandomRollout(board, true);
+            auto [winner, total_moves] = Default::LightRollout(board);
             auto score = CalcScore(init_player, winner); // 计算相对于局面初始应下玩家的价值
             value = 0.8*value + 0.2*score;
             if (value * score > 0) { // 若两次结果一样则可提前结束
@@ -93,7 +93,7 @@ struct Heuristic {
     // 优先度：+4 > -4 > +L3 == +To44 > -L3 == -To44 >= +To43 > -To43 > +To33 > -To33
     static auto DecisiveFilter(Evaluator& ev, Eigen::Ref<Eigen::VectorXf> probs) {
         // 数据准备
-        static std::deque<std::tuple<int, Player>> candidates;
+        thread_local std::deque<std::tuple<int, Player>> candidates; // 线程局部，以支持多线程搜索
         struct { enum { Anti, Favour, None } level = None; } report;
         enum State { _4, L3, To44, To43, To33, End } state = _4;
         auto cur_player = ev.board().m_curPlayer;
@@ -138,18 +138,26 @@ struct Heuristic {
                 candidates.pop_front();
             }
             // 如果仍有候选者，则寻找成功
-            if (int i = -1; !candidates.empty()) {
-                // 将所有非Decisive点概率全部Mask为0
-                probs = probs.unaryExpr([&](float prob) { // 这个较别扭的写法是为了vectorize的性能……
-                    return ++i, std::any_of(candidates.begin(), candidates.end(), [&](auto candidate) {
-                        auto [pattern, player] = candidate;
-                        if (pattern < Pattern::Size) {
-                            return ev.m_patternDist[i][pattern].get(player, cur_player);
-                        } else {
-                            return ev.m_compoundDist[i][pattern % Pattern::Size].get(player, cur_player);
+            if (!candidates.empty()) {
+                // 将所有非Decisive点概率全部Mask为0。只需遍历Evaluator中索引了对应模式的位置
+                thread_local Eigen::VectorXf decisive_probs;
+                decisive_probs.setZero(BOARD_SIZE);
+                for (auto [pattern, player] : candidates) {
+                    if (pattern < Pattern::Size) {
+                        for (Position pose : ev.positions(Pattern::Type(pattern))) {
+                            if (ev.m_patternDist[pose][pattern].get(player, cur_player)) {
+                                decisive_probs[pose] = probs[pose];
+                            }
                         }
-                    });
-                }).select(probs, Eigen::VectorXf::Zero((int)BOARD_SIZE)); 
+                    } else {
+                        for (Position pose : ev.positions(Compound::Type(pattern - Pattern::Size))) {
+                            if (ev.m_compoundDist[pose][pattern - Pattern::Size].get(player, cur_player)) {
+                                decisive_probs[pose] = probs[pose];
+                            }
+                        }
+                    }
+                }
+                probs = decisive_probs;
                 probs.normalize(); // 重新标准化概率
                 candidates.clear(); // 清空候选队列
                 state = State::End; // 状态直接跳转到结束
@@ -162,16 +170,18 @@ struct Heuristic {
 
     // 利用缓存策略下棋。
     // 此时，m_cachedActs标记成功缓存的记录区间的右界（左闭右开表示）
-    static Player CachedApplyMove(Board& base, Position move, Evaluator& evaluator, size_t& cached_acts) {
+    static Player CachedApplyMove(Board& base, Position move, Evaluator& evaluator, size_t& cached_acts, const Evaluator::Snapshot& root) {
         auto& ref = evaluator.board();
         if (cached_acts == ref.m_moveRecord.size() || ref.m_moveRecord[cached_acts] != move) {
             // 没有更多缓存记录或缓存失败，回退至最大缓存状态后继续下棋
-            if (ref.m_moveRecord.size() - cached_acts > cached_acts - 0) {
-                // 如果缓存的太少，不如重新计算
-                auto cached_record = std::move(ref.m_moveRecord);
-                evaluator.reset();
-                for (auto i = 0; i < cached_acts; ++i) {
-                    evaluator.applyMove(cached_record[i]);
+            const auto root_acts = root.board.m_moveRecord.size();
+            if (ref.m_moveRecord.size() - cached_acts > cached_acts - root_acts) {
+                // 如果缓存的太少，不如从根局面的快照重新计算
+                thread_local std::vector<Position> cached_record; // 线程局部，以支持多线程搜索
+                cached_record.assign(ref.m_moveRecord.begin() + root_acts, ref.m_moveRecord.begin() + cached_acts);
+                evaluator.restore(root);
+                for (auto cached_move : cached_record) {
+                    evaluator.applyMove(cached_move);
                 }
             } else {
                 // 否则，逆向回退至最后成功缓存的局面
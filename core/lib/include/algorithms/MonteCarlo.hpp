@@ -4,8 +4,13 @@
 #pragma warning(disable:4018) // 关闭有/无符号比较警告
 #include "../MCTS.h"
 #include "algorithms/Statistical.hpp"
+#include "algorithms/Vectorized.hpp"
 #include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <mutex>
 #include <tuple>
+#include <vector>
 
 // Algorithms名空间是一组静态方法的集合，并不继承Policy。
 namespace Gomoku::Algorithms {
@@ -21,9 +26,11 @@ struct Default {
 
     // 基于选子概率权重的PUCB公式。
     static double PUCB(const Node* node, double c_puct) {
-        const double P_i = node->action_prob;
-        const double N = node->parent->node_visits;
-        const double n_i = node->node_visits + 1;
+        return PUCB(node->action_prob, node->parent->node_visits, node->node_visits + 1, c_puct);
+    }
+
+    // PUCB公式的标量版本，便于直接作用于父结点中连续存储的子结点统计量。
+    static double PUCB(double P_i, double N, double n_i, double c_puct) {
         return c_puct * P_i * sqrt(N) / n_i;
     }
 
@@ -46,6 +53,18 @@ struct Default {
         return { winner, total_moves };
     }
 
+    // 在从board复制出的一次性棋盘上进行1局随机游戏，board本身不变。不产生棋谱，开销约为RandomRollout加悔棋的一半。
+    static std::tuple<Player, int> LightRollout(const Board& board) {
+        return RolloutBoard(board).play(RandomEngine::Local());
+    }
+
+    // 从board出发进行count局随机游戏，返回相对于board当前应下玩家的平均得分。
+    static float AveragedRollout(const Board& board, size_t count) {
+        auto results = RolloutBoard::PlayMany(board, int(count), RandomEngine::Local());
+        auto black_lead = results[static_cast<int>(Player::Black) + 1] - results[static_cast<int>(Player::White) + 1];
+        return CalcScore(board.m_curPlayer, float(black_lead) / count);
+    }
+
     // 返回均匀概率分布。
     static Eigen::VectorXf UniformProbs(Board& board) {
         Eigen::VectorXf action_probs = BoardMask(board).cast<float>();
@@ -54,22 +73,64 @@ struct Default {
         return action_probs;
     }
 
-    static Node* Select(Policy* policy, const Node* node) {
-        size_t max_index = 0;
-        double max_score = -1.0;
-        for (int i = 0; i < node->children.size(); ++i) {
-            auto child = node->children[i].get();
-            auto score = child->state_value + PUCB(child, policy->c_puct);
-            if (score > max_score) {
-                max_score = score, max_index = i;
-            }
+    using NodeLock = std::unique_lock<SpinLock>;
+
+    // 树并行搜索时锁定结点；单线程搜索时返回空锁。
+    static NodeLock LockNode(const Policy* policy, const Node* node) {
+        return policy->m_parallel ? NodeLock(node->mutex) : NodeLock();
+    }
+
+    // 锁定修改结点自身统计量所需的锁，即父结点（若有）与结点自身。
+    static std::pair<NodeLock, NodeLock> LockStats(const Policy* policy, const Node* node) {
+        auto parent_lock = node->parent ? LockNode(policy, node->parent) : NodeLock();
+        return { std::move(parent_lock), LockNode(policy, node) };
+    }
+
+    // 更新结点自身的统计量，并同步至父结点。调用方需持有LockStats对应的锁。
+    // 启用虚拟损失时，非根结点在选择阶段已计入一次虚拟损失（访问数+1，价值按-1计），此时替换为真实价值。
+    static void UpdateStats(const Policy* policy, Node* node, float value) {
+        if (policy->m_virtualLoss && node->parent != nullptr) {
+            node->state_value += (value + 1) / node->node_visits;
+        } else {
+            node->node_visits += 1;
+            node->state_value += (value - node->state_value) / node->node_visits;
+        }
+        if (node->parent != nullptr) {
+            node->parent->children.sync(node);
         }
-        return node->children[max_index].get();
+    }
+
+    // 对选中的子结点施加虚拟损失，使其他线程（或同一批次中的其他Playout）暂时避开该结点。调用方需持有父结点的锁。
+    static void ApplyVirtualLoss(const Policy* policy, Node* node) {
+        auto lock = LockNode(policy, node);
+        node->node_visits += 1;
+        node->state_value += (-1 - node->state_value) / node->node_visits;
+        node->parent->children.sync(node);
+    }
+
+    static Node* Select(Policy* policy, const Node* node) {
+        // 只读取父结点中的连续数组，不解引用子结点
+        const auto& children = node->children;
+        const float c_sqrtN = policy->c_puct * sqrt(node->node_visits);
+        auto max_index = Vectorized::ArgMaxPUCB(
+            children.values(), children.priors(), children.visits(), children.size(), c_sqrtN, -1.0f
+        );
+        return children[max_index];
     }
 
     // 根据传入的概率扩张结点。概率为0的Action将不被加入子结点中。
-    static size_t Expand(Policy* policy, Node* node, Board& board, const Eigen::VectorXf action_probs, bool extraCheck = true) {
-        node->children.reserve(action_probs.size());
+    static size_t Expand(Policy* policy, Node* node, Board& board, const Eigen::VectorXf& action_probs, bool extraCheck = true) {
+        if (policy->c_widening > 0) {
+            thread_local Policy::SparseProbs entries;
+            entries.clear();
+            for (int i = 0; i < BOARD_SIZE; ++i) {
+                if (action_probs[i] != 0.0 && (!extraCheck || board.checkMove(i))) {
+                    entries.emplace_back(i, action_probs[i]);
+                }
+            }
+            return ExpandLazily(policy, node, entries);
+        }
+        node->children.reserve((action_probs.array() != 0.0f).count());
         for (int i = 0; i < BOARD_SIZE; ++i) {
             // 后一个条件是额外的检查，防止不允许下的点意外添进树中（概率不为0）。
             if (action_probs[i] != 0.0 && (!extraCheck || board.checkMove(i))) {
@@ -79,31 +140,86 @@ struct Default {
         return node->children.size();
     }
 
+    // 根据稀疏的先验概率扩张结点，子结点按列表顺序加入。恰好预留列表长度的空间，无需扫描整个棋盘。
+    static size_t Expand(Policy* policy, Node* node, Board& board, const Policy::SparseProbs& action_probs, bool extraCheck = true) {
+        if (policy->c_widening > 0) {
+            thread_local Policy::SparseProbs entries;
+            entries.clear();
+            std::copy_if(action_probs.begin(), action_probs.end(), std::back_inserter(entries), [&](auto entry) {
+                return entry.second != 0.0 && (!extraCheck || board.checkMove(entry.first));
+            });
+            return ExpandLazily(policy, node, entries);
+        }
+        node->children.reserve(action_probs.size());
+        for (auto [pose, prob] : action_probs) {
+            if (prob != 0.0 && (!extraCheck || board.checkMove(pose))) {
+                node->children.emplace_back(policy->createNode(node, pose, -node->player, 0.0f, prob));
+            }
+        }
+        return node->children.size();
+    }
+
+    // 逐步展开：将子结点按先验概率从高到低登记（概率相同者顺序随机，以免均匀先验偏向棋盘一角），只创建进度允许的若干个。
+    static size_t ExpandLazily(Policy* policy, Node* node, Policy::SparseProbs& entries) {
+        std::shuffle(entries.begin(), entries.end(), RandomEngine::Local());
+        std::stable_sort(entries.begin(), entries.end(), [](auto lhs, auto rhs) { return lhs.second > rhs.second; });
+        node->children.reserve(entries.size());
+        for (auto [pose, prob] : entries) {
+            node->children.defer(pose, prob);
+        }
+        return Widen(policy, node);
+    }
+
+    // 访问n次的结点至多创建的子结点数。至少为1，以保证扩展后的结点不再是叶结点。
+    static size_t WideningLimit(const Policy* policy, const Node* node) {
+        return std::max<size_t>(1, std::ceil(policy->c_widening * sqrt(node->node_visits + 1.0)));
+    }
+
+    // 创建首个登记了的子结点。调用方需持有结点的锁。
+    static void Materialize(Policy* policy, Node* node) {
+        auto& children = node->children;
+        const auto i = children.size();
+        children.materialize(policy->createNode(node, children.positions()[i], -node->player, 0.0f, children.priors()[i]));
+    }
+
+    // 按逐步展开的进度补充创建子结点，返回新增的结点数。调用方需持有结点的锁。
+    static size_t Widen(Policy* policy, Node* node) {
+        const auto limit = WideningLimit(policy, node);
+        size_t count = 0;
+        for (; node->children.pending() != 0 && node->children.size() < limit; ++count) {
+            Materialize(policy, node);
+        }
+        return count;
+    }
+
     // 进行1局随机游戏。
     static Policy::EvalResult Simulate(Policy* policy, Board& board) {
-        auto init_player = board.m_curPlayer;
-        auto [winner, total_moves] = RandomRollout(board);
-        board.revertMove(total_moves);
-        return { CalcScore(init_player, winner), UniformProbs(board) };
+        auto [winner, total_moves] = LightRollout(board);
+        return { CalcScore(board.m_curPlayer, winner), UniformProbs(board) };
     }
 
     static void BackPropogate(Policy* policy, Node* node, Board& board, float value) {
         for (; node != nullptr; node = node->parent, value = -value) {
-            node->node_visits += 1;
-            node->state_value += (value - node->state_value) / node->node_visits;
+            auto locks = LockStats(policy, node);
+            UpdateStats(policy, node, value);
         }
     }
 
 	static void AddNoise(Node* node, float alpha = 0.05, float epsilon = 0.25) {
+		auto& children = node->children;
+		const auto entries = children.size() + children.pending(); // 尚未创建的子结点同样加噪
 		Eigen::VectorXf prior_probs;
 		prior_probs.setZero(BOARD_SIZE);
-		for (auto&& child : node->children) {
-			prior_probs[child->position] = child->action_prob;
+		for (size_t i = 0; i < entries; ++i) {
+			prior_probs[children.positions()[i]] = children.priors()[i];
 		}
 		prior_probs *= 1 - epsilon;
 		prior_probs += epsilon * Stats::DirichletNoise(prior_probs, alpha);
-		for (auto&& child : node->children) {
-			child->action_prob = prior_probs[child->position];
+		for (size_t i = 0; i < entries; ++i) {
+			children.priors()[i] = prior_probs[children.positions()[i]];
+			if (i < children.size()) {
+				children[i]->action_prob = children.priors()[i];
+			}
 		}
 	}
 
@@ -147,39 +263,42 @@ struct RAVE {
     */
 
     static Node* Select(Policy* policy, const Node* node) {
+        // 启用虚拟损失时，首位子结点会被各线程（或同一批次）同时选中，因此改为按计入虚拟损失后的统计量扫描
+        if (policy->m_virtualLoss) {
+            return Default::Select(policy, node);
+        }
         // 由于BackPropogate阶段已作过调整，只需取第一个值即可。
-        return node->children[0].get();
+        return node->children[0];
     }
 
     // 反向传播更新结点价值，要求传入的Board处于游戏结束的状态。
     template <bool UseRave = true>
     static void BackPropogate(Policy* policy, Node* node, Board& board, float value, double c_bias = 0.0) {
         for (; node != nullptr; node = node->parent, value = -value) {
-            size_t max_index = 0;
-            double max_score = -INFINITY;
-            // 计算最终得分，当UseRave为真时，更新并使用子结点的RAVE价值
-            for (int i = 0; i < node->children.size(); ++i) {
-                auto child_node = node->children[i].get();
-                auto score = Default::PUCB(child_node, policy->c_puct);
-                if constexpr (UseRave) {
-                    auto rave_node = static_cast<AMAFNode*>(child_node);
-                    if (board.moveState(rave_node->player, rave_node->position)) { // 要求是同一玩家下的
+            auto locks = Default::LockStats(policy, node);
+            auto& children = node->children;
+            const float* values = children.values();
+            // 当UseRave为真时，更新子结点的AMAF统计量（仍存于子结点中），并以RAVE价值代替结点价值参与评分
+            if constexpr (UseRave) {
+                thread_local std::vector<float> weighted_values;
+                weighted_values.resize(children.size());
+                const auto positions = children.positions();
+                for (size_t i = 0; i < children.size(); ++i) {
+                    auto rave_node = static_cast<AMAFNode*>(children[i]);
+                    if (board.moveState(rave_node->player, positions[i])) { // 要求是同一玩家下的
                         rave_node->amaf_visits += 1;
                         rave_node->amaf_value += (-value - rave_node->amaf_value) / rave_node->amaf_visits;
                     }
-                    score += WeightedValue(rave_node, c_bias);
-                } else {
-                    score += child_node->state_value;
-                }
-                if (score > max_score) {
-                    max_score = score, max_index = i;
+                    weighted_values[i] = WeightedValue(rave_node, c_bias);
                 }
+                values = weighted_values.data();
             }
-            if (!node->children.empty()) {
-                node->children[0].swap(node->children[max_index]); // 得分最大的子结点提升至容器首位
+            const float c_sqrtN = policy->c_puct * sqrt(node->node_visits);
+            auto max_index = Vectorized::ArgMaxPUCB(values, children.priors(), children.visits(), children.size(), c_sqrtN);
+            if (!children.empty()) {
+                children.swap(0, max_index); // 得分最大的子结点提升至容器首位
             }
-            node->node_visits += 1;
-            node->state_value += (value - node->state_value) / node->node_visits;
+            Default::UpdateStats(policy, node, value);
         }
     }
 
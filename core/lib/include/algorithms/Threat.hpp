@@ -0,0 +1,183 @@
+#ifndef GOMOKU_ALGORITHMS_THREAT_H_
+#define GOMOKU_ALGORITHMS_THREAT_H_
+#include "../Pattern.h"
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace Gomoku {
+
+inline namespace Config {
+    // 威胁空间搜索相关的默认配置
+    constexpr std::size_t C_VCF_NODES = 4096; // 根局面上每回合VCF搜索的结点上限，为0时不搜索
+    constexpr int C_VCF_DEPTH = 16; // 攻方至多连续冲四的手数
+    constexpr std::size_t C_VCF_CACHE = 1 << 14; // VCF置换表的项数，须为2的幂
+}
+
+}
+
+namespace Gomoku::Algorithms {
+
+/*
+    连续冲四取胜（VCF）求解器：攻方每手都须成四，守方只能在唯一的成五点上防守，直至攻方成五或同时形成两个成五点。
+    ① 攻方的候选手取自Evaluator中攻方活三/眠三的关键空位，成五点取自四连棋型的关键空位，并由Board::completesFive逐一复核。
+       因此证明的必胜总是成立的，候选手不全只会漏解。
+    ② 结果以局面的规范哈希（SymmetricHash::canonical）为键缓存于定长的直接映射置换表，对称的局面共用表项。
+       表项只描述局面本身（应下一方能否VCF），故可跨回合保留。
+    ③ 搜索受结点数与时长的双重限制，预算耗尽时中止，且不缓存中止时的结论。
+*/
+class ThreatSolver {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Result {
+        enum { Unknown, Win, Loss } proof = Unknown; // 相对于当前应下一方
+        Position move = Position::npos; // 必胜时的首手
+    };
+
+    explicit ThreatSolver(int c_depth = C_VCF_DEPTH, std::size_t c_cacheSize = C_VCF_CACHE) :
+        c_depth(c_depth), m_table(c_cacheSize) {
+        if (c_cacheSize == 0 || (c_cacheSize & (c_cacheSize - 1)) != 0) {
+            throw std::invalid_argument("VCF cache size must be a power of two");
+        }
+    }
+
+    /*
+        为ev局面上的当前应下一方求解：
+        - Win:  存在VCF（含一手成五），move为首手。
+        - Loss: 己方无成五点而对方已有两个成五点。
+        - Unknown: 未能在预算（budget个结点，duration为0时不限时）内证明。
+        搜索前后ev的局面不变。
+    */
+    Result solve(Evaluator& ev, std::size_t budget, std::chrono::milliseconds duration = {}) {
+        m_nodes = 0;
+        m_budget = budget;
+        m_timed = duration.count() > 0;
+        m_deadline = Clock::now() + duration;
+        m_aborted = false;
+        Result result;
+        const auto player = ev.board().m_curPlayer;
+        if (player == Player::None || budget == 0) {
+            return result;
+        }
+        Position spots[2];
+        if (FiveSpots(ev, player, spots, 1) == 0 && FiveSpots(ev, -player, spots, 2) == 2) {
+            result.proof = Result::Loss;
+        } else if (search(ev, c_depth, result.move)) {
+            result.proof = Result::Win;
+        }
+        return result;
+    }
+
+    // 清空置换表
+    void clear() {
+        std::fill(m_table.begin(), m_table.end(), Entry{});
+    }
+
+    // 玩家player的成五点，至多收集limit（不超过2）个，返回收集到的个数
+    static int FiveSpots(Evaluator& ev, Player player, Position* spots, int limit) {
+        int count = 0;
+        for (auto type : { Pattern::LiveFour, Pattern::DeadFour }) {
+            for (Position pose : ev.positions(type)) {
+                if (ev.m_patternDist[pose][type].get(player, player)
+                    && (count == 0 || spots[0] != pose)
+                    && ev.board().completesFive(pose, player)) {
+                    spots[count++] = pose;
+                    if (count == limit) {
+                        return count;
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+public:
+    int c_depth; // 攻方至多连续冲四的手数
+    std::size_t m_nodes = 0; // 上一次求解访问的结点数
+    bool m_aborted = false; // 上一次求解是否因预算耗尽而中止
+
+private:
+    struct Entry {
+        std::uint64_t hash = 0;
+        Position move = Position::npos; // 必胜的首手；为npos时表示在depth手内无VCF
+        int depth = -1;
+    };
+
+    bool exhausted() {
+        if (m_nodes >= m_budget || (m_timed && m_nodes % 64 == 0 && Clock::now() >= m_deadline)) {
+            m_aborted = true;
+        }
+        return m_aborted;
+    }
+
+    // 当前应下一方能否在depth手冲四内取胜。能则由move返回首手
+    bool search(Evaluator& ev, int depth, Position& move) {
+        ++m_nodes;
+        const auto attacker = ev.board().m_curPlayer;
+        Position spots[2];
+        if (FiveSpots(ev, attacker, spots, 1) == 1) {
+            return move = spots[0], true;
+        }
+        const auto threats = FiveSpots(ev, -attacker, spots, 2);
+        if (threats == 2 || depth == 0 || exhausted()) {
+            return false;
+        }
+        const auto symmetry = ev.m_boardMap.m_symmetry.symmetry();
+        const auto hash = ev.m_boardMap.m_symmetry.hashes[symmetry];
+        if (auto& entry = m_table[hash & (m_table.size() - 1)]; entry.hash == hash) {
+            if (entry.move != Position::npos) { // 首手按规范变换存储
+                return move = BoardHash::Transform(entry.move, BoardHash::Inverse(symmetry)), true;
+            } else if (entry.depth >= depth) {
+                return false;
+            }
+        }
+        // 对方已成四时只能先挡住，且挡的一手须同时成四；否则依次尝试活三、眠三的关键空位
+        FixedVector<Position, BOARD_SIZE> candidates;
+        if (threats == 1) {
+            candidates.emplace_back(spots[0]);
+        } else {
+            Bitboard added;
+            for (auto type : { Pattern::LiveThree, Pattern::DeadThree }) {
+                for (Position pose : ev.positions(type)) {
+                    if (!added.test(pose) && ev.m_patternDist[pose][type].get(attacker, attacker)) {
+                        added.set(pose);
+                        candidates.emplace_back(pose);
+                    }
+                }
+            }
+        }
+        for (auto candidate : candidates) {
+            ev.applyMove(candidate);
+            Position fives[2];
+            const auto count = FiveSpots(ev, attacker, fives, 2);
+            bool win = count == 2; // 守方无成五点（已被挡住或从未有过），无法同时挡住两处
+            if (count == 1) {
+                ev.applyMove(fives[0]); // 守方唯一的应手
+                Position next;
+                win = search(ev, depth - 1, next);
+                ev.revertMove();
+            }
+            ev.revertMove();
+            if (win) {
+                m_table[hash & (m_table.size() - 1)] = { hash, BoardHash::Transform(candidate, symmetry), depth };
+                return move = candidate, true;
+            } else if (m_aborted) {
+                return false;
+            }
+        }
+        m_table[hash & (m_table.size() - 1)] = { hash, Position::npos, depth };
+        return false;
+    }
+
+private:
+    std::vector<Entry> m_table;
+    std::size_t m_budget = 0;
+    bool m_timed = false;
+    Clock::time_point m_deadline;
+};
+
+}
+
+#endif // !GOMOKU_ALGORITHMS_THREAT_H_
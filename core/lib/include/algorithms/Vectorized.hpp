@@ -0,0 +1,93 @@
+#ifndef GOMOKU_ALGORITHMS_VECTORIZED_H_
+#define GOMOKU_ALGORITHMS_VECTORIZED_H_
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// 按编译选项选择指令集：AVX（/arch:AVX 或 -mavx 及以上） > SSE2（x64默认可用） > 标量实现
+#if defined(__AVX__)
+#define GOMOKU_SIMD_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GOMOKU_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+// Algorithms名空间是一组静态方法的集合，并不继承Policy。
+namespace Gomoku::Algorithms {
+
+struct Vectorized {
+
+    /*
+        在连续存储的子结点统计量上求PUCB得分最大者的下标：
+            argmax_i { Q_i + c_sqrtN * P_i / (n_i + 1) }
+        其中c_sqrtN = c_puct * sqrt(N)与子结点无关，由调用方在循环外算好。
+        得分相同时取下标最小者；若没有得分严格大于threshold的子结点，则返回0。
+    */
+    static std::size_t ArgMaxPUCB(const float* Q, const float* P, const std::uint32_t* n, std::size_t size,
+                                  float c_sqrtN, float threshold = -INFINITY) {
+        float max_score = threshold;
+        std::size_t max_index = 0, i = 0;
+#if defined(GOMOKU_SIMD_AVX)
+        if (size >= 8) {
+            const auto c = _mm256_set1_ps(c_sqrtN), one = _mm256_set1_ps(1.0f), step = _mm256_set1_ps(8.0f);
+            auto best_score = _mm256_set1_ps(threshold), best_index = _mm256_setzero_ps();
+            auto index = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7); // 下标以float存储，2^24以内可精确表示
+            for (; i + 8 <= size; i += 8, index = _mm256_add_ps(index, step)) {
+                auto visits = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(n + i)));
+                auto explore = _mm256_div_ps(_mm256_mul_ps(c, _mm256_loadu_ps(P + i)), _mm256_add_ps(visits, one));
+                auto score = _mm256_add_ps(_mm256_loadu_ps(Q + i), explore);
+                auto greater = _mm256_cmp_ps(score, best_score, _CMP_GT_OQ);
+                best_score = _mm256_blendv_ps(best_score, score, greater);
+                best_index = _mm256_blendv_ps(best_index, index, greater);
+            }
+            alignas(32) float scores[8], indices[8];
+            _mm256_store_ps(scores, best_score);
+            _mm256_store_ps(indices, best_index);
+            ReduceLanes(scores, indices, 8, max_score, max_index);
+        }
+#elif defined(GOMOKU_SIMD_SSE)
+        if (size >= 4) {
+            const auto c = _mm_set1_ps(c_sqrtN), one = _mm_set1_ps(1.0f), step = _mm_set1_ps(4.0f);
+            auto best_score = _mm_set1_ps(threshold), best_index = _mm_setzero_ps();
+            auto index = _mm_setr_ps(0, 1, 2, 3); // 下标以float存储，2^24以内可精确表示
+            for (; i + 4 <= size; i += 4, index = _mm_add_ps(index, step)) {
+                auto visits = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(n + i)));
+                auto explore = _mm_div_ps(_mm_mul_ps(c, _mm_loadu_ps(P + i)), _mm_add_ps(visits, one));
+                auto score = _mm_add_ps(_mm_loadu_ps(Q + i), explore);
+                auto greater = _mm_cmpgt_ps(score, best_score);
+                best_score = _mm_or_ps(_mm_and_ps(greater, score), _mm_andnot_ps(greater, best_score));
+                best_index = _mm_or_ps(_mm_and_ps(greater, index), _mm_andnot_ps(greater, best_index));
+            }
+            alignas(16) float scores[4], indices[4];
+            _mm_store_ps(scores, best_score);
+            _mm_store_ps(indices, best_index);
+            ReduceLanes(scores, indices, 4, max_score, max_index);
+        }
+#endif
+        // 标量实现，同时处理向量化后剩余的尾部元素
+        for (; i < size; ++i) {
+            auto score = Q[i] + c_sqrtN * P[i] / (n[i] + 1.0f);
+            if (score > max_score) {
+                max_score = score, max_index = i;
+            }
+        }
+        return max_index;
+    }
+
+private:
+    // 合并各通道的最大值。得分相同时取下标最小者，以与逐个扫描的结果保持一致。
+    static void ReduceLanes(const float* scores, const float* indices, int lanes, float& max_score, std::size_t& max_index) {
+        for (int k = 0; k < lanes; ++k) {
+            auto index = static_cast<std::size_t>(indices[k]);
+            if (scores[k] > max_score || (scores[k] == max_score && index < max_index)) {
+                max_score = scores[k], max_index = index;
+            }
+        }
+    }
+
+};
+
+}
+
+#endif // !GOMOKU_ALGORITHMS_VECTORIZED_H_
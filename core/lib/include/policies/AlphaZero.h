@@ -1,53 +1,113 @@
 #ifndef GOMOKU_POLICY_ALPHAZERO_H_
 #define GOMOKU_POLICY_ALPHAZERO_H_
 #include "../MCTS.h"
-#include "../algorithms/Default.h"
-#include <tensorflow/core/public/session.h>
-#include <tensorflow/core/platform/env.h>
-#include <tensorflow/core/framework/graph_def_util.h>
+#include "../Network.h"
+#include "../Transposition.h"
+#include "../algorithms/MonteCarlo.hpp"
 
 namespace Gomoku::Policies {
 
-namespace tf = tensorflow;
-
+// ԲԼֵҶĲԣҶ㰴ξһǰ򴫲
 class AlphaZeroPolicy : public Policy {
 public:
-    using Default = Algorithms::Default; // Ĭ㷨
+    // Ĭ㷨
+    using Default = Algorithms::Default;
 
-    AlphaZeroPolicy(std::string model_path, double puct = C_PUCT) :
-        Policy(nullptr, nullptr, [this](auto& board) { return networkEvaluate(board); }, nullptr, puct), 
-        m_modelPath(std::move(model_path)) {
+    // ֻڸ乲
+    AlphaZeroPolicy(std::shared_ptr<const PolicyValueNetwork> network, double c_puct = C_PUCT, size_t c_batchSize = C_BATCH_SIZE) :
+        Policy(nullptr, nullptr, [this](auto& board) { return networkEvaluate(board); }, nullptr, c_puct, 
+               [this](auto& boards) { return networkEvaluate(boards); }, c_batchSize),
+        m_network(std::move(network)) {
 
     }
 
-    EvalResult networkEvaluate(Board& board) {
-        auto init_player = board.m_curPlayer;
-        std::vector<tf::Tensor> outputs;
+    // PolicyValueNetwork.export_nativeȨ
+    AlphaZeroPolicy(const std::string& model_path, double c_puct = C_PUCT, size_t c_batchSize = C_BATCH_SIZE) :
+        AlphaZeroPolicy(std::make_shared<const PolicyValueNetwork>(model_path), c_puct, c_batchSize) {
 
-        m_session->Run({
-            {"", tf::Tensor()}
-            }, { "" }, {}, outputs);
     }
 
+    virtual std::shared_ptr<Policy> clone() const override {
+        auto policy = std::make_shared<AlphaZeroPolicy>(m_network, c_puct, c_batchSize);
+        policy->c_widening = c_widening;
+        policy->m_cache = m_cache;
+        return policy;
+    }
+
+    // Ըؽƽ棬˺еά
     virtual void prepare(Board& board) override {
         Policy::prepare(board);
+        m_features = FeaturePlanes(board);
+    }
+
+    virtual Player applyMove(Board& board, Position move) override {
+        m_features.applyMove(move, board.m_curPlayer, board.m_moveRecord);
+        return Policy::applyMove(board, move);
+    }
+
+    virtual Player revertMove(Board& board, size_t count) override {
+        for (size_t i = 0; i < count && !board.m_moveRecord.empty(); ++i) {
+            const auto move = board.m_moveRecord.back();
+            Policy::revertMove(board, 1);
+            m_features.revertMove(move, board.m_curPlayer, board.m_moveRecord);
+        }
+        return board.m_curPlayer;
+    }
+
+    // ֱӿάƽ棬board뾭prepareapplyMove/revertMoveͬ
+    EvalResult networkEvaluate(Board& board) {
+        if (m_cache) {
+            if (auto cached = m_cache->probe(board)) {
+                return std::move(*cached);
+            }
+        }
+        std::array<std::uint8_t, FeaturePlanes::Planes * BOARD_SIZE> states;
+        m_features.copyTo(states.data());
+        auto evaluated = m_network->evaluate(states.data(), 1);
+        EvalResult result = { std::get<0>(evaluated[0]), MaskedProbs(board, std::get<1>(evaluated[0])) };
+        if (m_cache) {
+            m_cache->store(board, result);
+        }
+        return result;
+    }
+
+    std::vector<EvalResult> networkEvaluate(const std::vector<Board>& boards) {
+        if (m_cache) { // ֻδеľ
+            return EvaluationCache::Cached(m_cache, [this](const std::vector<Board>& misses) { return batchEvaluate(misses); })(boards);
+        }
+        return batchEvaluate(boards);
+    }
+
+    // ľΪҶ㴦̸ɸԵӼ¼
+    std::vector<EvalResult> batchEvaluate(const std::vector<Board>& boards) {
+        auto evaluated = m_network->evaluate(boards);
+        std::vector<EvalResult> results;
+        results.reserve(boards.size());
+        for (size_t i = 0; i < boards.size(); ++i) {
+            results.emplace_back(std::get<0>(evaluated[i]), MaskedProbs(boards[i], std::get<1>(evaluated[i])));
+        }
+        return results;
     }
 
-    virtual void reset() override {
-        auto status_load = tf::ReadBinaryProto(tf::Env::Default(), m_modelPath, &m_graphDef);
-        if (!status_load.ok()) {
-            throw std::runtime_error(status_load.ToString());
+    // ȥӴĸʲ¹һλĸȫΪ0ʱ˻Ϊȷֲ
+    static Eigen::VectorXf MaskedProbs(const Board& board, const Eigen::VectorXf& probs) {
+        auto& empty = board.moveStates(Player::None);
+        Eigen::VectorXf masked(BOARD_SIZE);
+        for (int i = 0; i < BOARD_SIZE; ++i) {
+            masked[i] = empty[i] ? probs[i] : 0.0f;
         }
-        auto status_create = m_session->Create(m_graphDef);
-        if (!status_create.ok()) {
-            throw std::runtime_error(status_create.ToString());
+        if (masked.sum() <= 0) {
+            for (int i = 0; i < BOARD_SIZE; ++i) {
+                masked[i] = empty[i];
+            }
         }
+        return masked / masked.sum();
     }
 
 public:
-    std::string m_modelPath;
-    std::unique_ptr<tf::Session> m_session;
-    tf::GraphDef m_graphDef;
+    std::shared_ptr<const PolicyValueNetwork> m_network;
+    FeaturePlanes m_features; // еͬ
+    std::shared_ptr<EvaluationCache> m_cache; // Ļ棬Ϊʱáڸֶļ乲
 };
 
 }
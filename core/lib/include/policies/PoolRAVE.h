@@ -10,14 +10,20 @@ public:
     using RAVE = Gomoku::Algorithms::RAVE; // 引入RAVE算法
     using AMAFNode = RAVE::AMAFNode; // 选择AMAFNode作为结点类型
 
-    PoolRAVEPolicy(double c_puct = 1e-4, double c_bias = 1e-1) :
+    PoolRAVEPolicy(double c_puct = 1e-4, double c_bias = 1e-1, double c_widening = C_WIDENING) :
         Policy(
             [this](auto node) { return RAVE::Select(this, node); },
-            [this](auto node, auto& board, auto probs) { return Default::Expand(this, node, board, std::move(probs), false); }, // 不进行额外有效性检查
+            [this](auto node, auto& board, const auto& probs) { return Default::Expand(this, node, board, probs, false); }, // 不进行额外有效性检查
             [this](auto& board) { return defaultSimulate(board); },
             [this](auto node, auto& board, auto value) { return RAVE::BackPropogate(this, node, board, value, this->c_bias); },
             c_puct), c_bias(c_bias) {
+        this->c_widening = c_widening;
+    }
 
+    virtual std::shared_ptr<Policy> clone() const override {
+        auto policy = std::make_shared<PoolRAVEPolicy>(c_puct, c_bias, c_widening);
+        policy->c_batchSize = c_batchSize;
+        return policy;
     }
 
     virtual std::unique_ptr<Node> createNode(Node* parent, Position pose, Player player, float value, float prob) {
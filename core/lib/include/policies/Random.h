@@ -12,25 +12,21 @@ public:
     // 引入默认算法
     using Default = Algorithms::Default; 
 
-    RandomPolicy(double c_puct = C_PUCT, size_t c_rollouts = 5) : 
+    RandomPolicy(double c_puct = C_PUCT, size_t c_rollouts = 5, double c_widening = C_WIDENING) : 
         Policy(nullptr, nullptr, [this](auto& board) { return averagedSimulate(board); }, nullptr, c_puct), 
         c_rollouts(c_rollouts) {
+        this->c_widening = c_widening;
+    }
 
+    virtual std::shared_ptr<Policy> clone() const override {
+        auto policy = std::make_shared<RandomPolicy>(c_puct, c_rollouts, c_widening);
+        policy->c_batchSize = c_batchSize;
+        return policy;
     }
 
     // 随机下棋直到游戏结束（进行多盘取平均值）
     EvalResult averagedSimulate(Board& board) {  
-        auto init_player = board.m_curPlayer;
-        double score = 0;
-
-        for (int i = 0; i < c_rollouts; ++i) {
-            auto [winner, total_moves] = Default::RandomRollout(board);
-            // score += CalcScore(Player::Black, winner);   // 计算绝对价值，黑棋越赢越接近1，白棋越赢越接近-1
-            score += CalcScore(init_player, winner);      // 计算相对于局面初始应下玩家的价值
-            board.revertMove(total_moves); // 重置棋盘至传入时状态，注意赢家会重设为Player::None。
-        }
-        score /= c_rollouts;
-
+        auto score = Default::AveragedRollout(board, c_rollouts); // 相对于局面初始应下玩家的价值，棋盘不变
         return { score, Default::UniformProbs(board) };
     }
 
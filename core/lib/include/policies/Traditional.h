@@ -4,6 +4,7 @@
 #include "../Pattern.h"
 #include "../algorithms/MonteCarlo.hpp"
 #include "../algorithms/Heuristic.hpp"
+#include "../algorithms/Threat.hpp"
 
 namespace Gomoku::Policies {
 
@@ -17,21 +18,48 @@ public:
     TraditionalPolicy(double puct = C_PUCT) :
         Policy(
             [this](auto node)                          { return RAVE::Select(this, node); },
-            [this](auto node, auto& board, auto probs) { return Default::Expand(this, node, m_evaluator.board(), std::move(probs), false); },
+            [this](auto node, auto&, const auto& probs) { return Default::Expand(this, node, m_evaluator.board(), probs, false); },
             [this](auto& board)                        { return hybridSimulate(m_evaluator.board()); },
             [this](auto node, auto& board, auto value) { return RAVE::BackPropogate<false>(this, node, m_evaluator.board(), value); },
             puct) {
+        m_evaluator.save(m_root);
+    }
 
+    // 副本拥有独立的Evaluator与VCF置换表，在prepare时与棋盘同步
+    virtual std::shared_ptr<Policy> clone() const override {
+        auto policy = std::make_shared<TraditionalPolicy>(c_puct);
+        policy->c_rootNodes = c_rootNodes;
+        policy->c_leafNodes = c_leafNodes;
+        policy->c_widening = c_widening;
+        policy->c_batchSize = c_batchSize;
+        return policy;
     }
 
+    // 以上一回合的根局面快照为基准同步，并为本回合的根局面建立快照
     virtual void prepare(Board& board) override {
         Policy::prepare(board);
-        m_evaluator.syncWithBoard(board);
+        m_evaluator.syncWithBoard(board, m_root);
+        m_evaluator.save(m_root);
         m_cachedActs = m_initActs; // 视初始状态时已下的棋为已缓存
+        m_evaluator.m_applies = m_evaluator.m_reverts = 0; // 同步棋盘的更新不计入搜索统计
+        if (c_rootNodes > 0) { // 根局面已有VCF时，无需再搜索
+            if (auto result = m_solver.solve(m_evaluator, c_rootNodes); result.proof == result.Win) {
+                m_provenMove = result.move;
+            }
+        }
+    }
+
+    virtual void cleanup(Board& board) override {
+        Policy::cleanup(board);
+        m_stats.applies += m_evaluator.m_applies;
+        m_stats.reverts += m_evaluator.m_reverts;
     }
 
     virtual Player applyMove(Board& board, Position move) override {
-        return Heuristic::CachedApplyMove(board, move, m_evaluator, m_cachedActs);
+        const auto applies = m_evaluator.m_applies;
+        auto result = Heuristic::CachedApplyMove(board, move, m_evaluator, m_cachedActs, m_root);
+        ++(m_evaluator.m_applies == applies ? m_stats.cacheHits : m_stats.cacheMisses); // 命中缓存时评估器无需更新
+        return result;
     }
 
     virtual Player revertMove(Board& board, size_t count) override {
@@ -51,6 +79,15 @@ public:
         auto& ev = m_evaluator;
         auto action_probs = Heuristic::EvaluationProbs(m_evaluator, init_player);
         auto report = Heuristic::DecisiveFilter(m_evaluator, action_probs);
+        if (c_leafNodes > 0) { // 以VCF的证明结果短路评估
+            if (auto result = m_solver.solve(m_evaluator, c_leafNodes); result.proof == result.Win) {
+                action_probs.setZero();
+                action_probs[result.move] = 1.0f;
+                return { 1.0, action_probs };
+            } else if (result.proof == result.Loss) {
+                return { -1.0, action_probs };
+            }
+        }
         if (report.level == report.Favour) {
             return { 1.0, action_probs };
         } else {
@@ -69,8 +106,12 @@ public:
     }
 
 public:
+    size_t c_rootNodes = C_VCF_NODES; // 每回合在根局面上搜索VCF的结点上限，为0时不搜索
+    size_t c_leafNodes = 0; // 每次评估叶结点前搜索VCF的结点上限，为0时不搜索
     size_t m_cachedActs = 0;
     Evaluator m_evaluator;
+    Evaluator::Snapshot m_root; // 根局面的快照，即applyMove缓存失效时的回退基准
+    Algorithms::ThreatSolver m_solver; // 根局面与叶结点共用的VCF求解器，其置换表跨回合保留
 };
 
 }
@@ -0,0 +1,283 @@
+#include "AlphaBeta.h"
+#include "Pattern.h"
+#include "algorithms/Heuristic.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <thread>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+namespace Gomoku {
+
+using Algorithms::Heuristic;
+using Algorithms::ThreatSolver;
+
+/* ------------------- AlphaBeta类实现 ------------------- */
+
+// 各线程独立的搜索状态
+struct AlphaBeta::Worker {
+    Evaluator ev;
+    Position killers[C_AB_MAX_PLY][2]; // 各层最近两次引发β截断的着法
+    int history[2][BOARD_SIZE] = {}; // 按Evaluator::Group(player)分组的历史启发分数
+    size_t nodes = 0;
+    size_t hits = 0;
+    Position rootMove = Position::npos; // 当前迭代中根局面的最好手
+    Position best = Position::npos; // 最后一次完成的迭代的结论
+    int score = 0;
+    int depth = 0;
+};
+
+// 胜负分数以相对于根局面的层数存储，存取时按当前层数换算
+inline bool isMate(int score) { return std::abs(score) >= AlphaBeta::WIN - C_AB_MAX_PLY; }
+inline int toTable(int score, int ply) { return isMate(score) ? score + (score > 0 ? ply : -ply) : score; }
+inline int fromTable(int score, int ply) { return isMate(score) ? score - (score > 0 ? ply : -ply) : score; }
+
+AlphaBeta::AlphaBeta(milliseconds c_duration, size_t c_threads, size_t c_tableSize) : c_duration(c_duration) {
+    if (c_threads == 0) {
+        throw invalid_argument("alpha-beta search requires at least one thread");
+    }
+    size_t size = 1;
+    while (size < c_tableSize) {
+        size <<= 1;
+    }
+    m_table.reset(new Entry[size]());
+    m_mask = size - 1;
+    for (size_t i = 0; i < c_threads; ++i) {
+        m_workers.push_back(make_unique<Worker>());
+    }
+}
+
+AlphaBeta::~AlphaBeta() = default;
+
+bool AlphaBeta::probe(uint64_t hash, int& depth, int& score, Bound& bound, Position& move) const {
+    auto& entry = m_table[hash & m_mask];
+    const auto data = entry.data.load(memory_order_relaxed);
+    if ((entry.check.load(memory_order_relaxed) ^ data) != hash || (data >> 40 & 3) == 0) {
+        return false;
+    }
+    move = Position(int16_t(data & 0xFFFF));
+    score = int16_t(data >> 16 & 0xFFFF);
+    depth = int(data >> 32 & 0xFF);
+    bound = Bound(data >> 40 & 3);
+    return true;
+}
+
+void AlphaBeta::store(uint64_t hash, int depth, int score, Bound bound, Position move) {
+    auto& entry = m_table[hash & m_mask];
+    const auto old = entry.data.load(memory_order_relaxed);
+    if ((entry.check.load(memory_order_relaxed) ^ old) == hash && int(old >> 32 & 0xFF) > depth) {
+        return; // 同一局面保留更深的结果
+    }
+    const uint64_t data = uint64_t(uint16_t(move.id)) | uint64_t(uint16_t(int16_t(score))) << 16
+                        | uint64_t(depth & 0xFF) << 32 | uint64_t(bound) << 40;
+    entry.check.store(hash ^ data, memory_order_relaxed);
+    entry.data.store(data, memory_order_relaxed);
+}
+
+int AlphaBeta::search(Worker& worker, int depth, int alpha, int beta, int ply) {
+    auto& ev = worker.ev;
+    auto& board = ev.board();
+    if ((++worker.nodes & 1023) == 0 && Clock::now() >= m_deadline) {
+        m_stop.store(true, memory_order_relaxed);
+    }
+    if (m_stop.load(memory_order_relaxed)) {
+        return 0;
+    }
+    if (ev.checkGameEnd()) {
+        return board.m_winner == Player::None ? 0 : -(WIN - ply); // 上一手已成五
+    }
+    // 成五与双四的胜负无需搜索
+    const auto player = board.m_curPlayer;
+    Position spots[2];
+    const auto fives = ThreatSolver::FiveSpots(ev, player, spots, 1);
+    const auto threats = fives ? 0 : ThreatSolver::FiveSpots(ev, -player, spots, 2);
+    if (fives == 1 || threats == 2) {
+        if (ply == 0) {
+            worker.rootMove = spots[0];
+        }
+        return fives == 1 ? WIN - ply - 1 : -(WIN - ply - 2);
+    }
+    if (depth <= 0 || ply >= C_AB_MAX_PLY - 1) {
+        return int(Heuristic::EvaluationValue(ev, player) * EVAL_SCALE);
+    }
+    // 以规范哈希为键，对称的局面共用表项；表中的着法按规范变换存储
+    const auto symmetry = ev.m_boardMap.m_symmetry.symmetry();
+    const auto hash = ev.m_boardMap.m_symmetry.hashes[symmetry];
+    Position table_move = Position::npos;
+    int table_depth, table_score;
+    Bound table_bound;
+    if (probe(hash, table_depth, table_score, table_bound, table_move)) {
+        ++worker.hits;
+        if (table_move != Position::npos) {
+            table_move = BoardHash::Transform(table_move, BoardHash::Inverse(symmetry));
+        }
+        table_score = fromTable(table_score, ply);
+        if (ply > 0 && table_depth >= depth && (table_bound == Exact
+            || (table_bound == Lower && table_score >= beta) || (table_bound == Upper && table_score <= alpha))) {
+            return table_score;
+        }
+    }
+
+    // 对方已成四时只能挡住；否则保留启发式概率最高的若干手，依次按置换表、杀手与历史启发排序
+    Position moves[BOARD_SIZE];
+    int count = 0;
+    if (threats == 1) {
+        moves[count++] = spots[0];
+    } else {
+        Eigen::VectorXf probs = Heuristic::EvaluationProbs(ev, player);
+        Heuristic::DecisiveFilter(ev, probs);
+        for (int i = 0; i < BOARD_SIZE; ++i) {
+            if (probs[i] > 0 && board.checkMove(i)) { // 概率全为0时标准化得到NaN，同样会被滤去
+                moves[count++] = i;
+            }
+        }
+        const auto kept = std::min<int>(count, int(c_candidates));
+        partial_sort(moves, moves + kept, moves + count, [&](Position lhs, Position rhs) { return probs[lhs] > probs[rhs]; });
+        count = kept;
+        if (table_move != Position::npos && board.checkMove(table_move) && find(moves, moves + count, table_move) == moves + count) {
+            moves[count++] = table_move; // 其他线程或更浅的搜索得出的最好手不在候选中时，仍优先尝试
+        }
+        if (count == 0) {
+            moves[count++] = board.getRandomMove();
+        }
+        const auto& killers = worker.killers[ply];
+        const auto& history = worker.history[Evaluator::Group(player)];
+        const auto key = [&](Position move) {
+            return move == table_move ? INT_MAX : move == killers[0] ? INT_MAX - 1 : move == killers[1] ? INT_MAX - 2 : history[move];
+        };
+        stable_sort(moves, moves + count, [&](Position lhs, Position rhs) { return key(lhs) > key(rhs); });
+    }
+
+    int best = -WIN - 1;
+    Position best_move = Position::npos;
+    Bound bound = Upper;
+    for (int i = 0; i < count; ++i) {
+        ev.applyMove(moves[i]);
+        int score;
+        if (i == 0) {
+            score = -search(worker, depth - 1, -beta, -alpha, ply + 1);
+        } else { // 以零窗口验证其余着法不优于当前最好手，失败时再以完整窗口重新搜索
+            score = -search(worker, depth - 1, -alpha - 1, -alpha, ply + 1);
+            if (score > alpha && score < beta) {
+                score = -search(worker, depth - 1, -beta, -alpha, ply + 1);
+            }
+        }
+        ev.revertMove();
+        if (m_stop.load(memory_order_relaxed)) {
+            return 0;
+        }
+        if (score > best) {
+            best = score, best_move = moves[i];
+            if (ply == 0) {
+                worker.rootMove = moves[i];
+            }
+        }
+        if (score > alpha) {
+            alpha = score, bound = Exact;
+        }
+        if (alpha >= beta) {
+            bound = Lower;
+            if (auto& killers = worker.killers[ply]; killers[0] != moves[i]) {
+                killers[1] = killers[0], killers[0] = moves[i];
+            }
+            worker.history[Evaluator::Group(player)][moves[i]] += depth * depth;
+            break;
+        }
+    }
+    store(hash, depth, toTable(best, ply), bound, best_move == Position::npos ? best_move : BoardHash::Transform(best_move, symmetry));
+    return best;
+}
+
+void AlphaBeta::deepen(Worker& worker, int first_depth) {
+    const bool main = &worker == m_workers[0].get();
+    for (int depth = first_depth; depth <= std::min(c_maxDepth, C_AB_MAX_PLY - 1); ++depth) {
+        worker.rootMove = Position::npos;
+        const auto score = search(worker, depth, -WIN - 1, WIN + 1, 0);
+        if (m_stop.load(memory_order_relaxed)) {
+            break;
+        }
+        worker.best = worker.rootMove, worker.score = score, worker.depth = depth;
+        if (isMate(score)) {
+            break; // 已分胜负，更深的搜索不会改变结论
+        }
+        if (main && Clock::now() - m_start > (m_deadline - m_start) / 2) {
+            break; // 下一层的用时一般数倍于本层，多半无法完成
+        }
+    }
+}
+
+Position AlphaBeta::getAction(Board& board) {
+    m_start = Clock::now();
+    if (m_timer) {
+        m_timer->start();
+    }
+    m_deadline = m_start + (m_timer ? m_timer->m_budget : c_duration);
+    m_stop.store(false, memory_order_relaxed);
+    for (auto&& worker : m_workers) {
+        worker->ev.syncWithBoard(board);
+        worker->nodes = worker->hits = 0;
+        worker->rootMove = worker->best = Position::npos;
+        worker->score = worker->depth = 0;
+        std::fill(&worker->killers[0][0], &worker->killers[0][0] + 2 * C_AB_MAX_PLY, Position::npos);
+        for (auto& history : worker->history) { // 衰减上一步的历史启发
+            for (auto& score : history) {
+                score /= 8;
+            }
+        }
+    }
+    auto& main = *m_workers[0];
+    Position move = Position::npos;
+    m_depth = m_score = 0;
+    if (c_vcfNodes > 0) {
+        if (auto result = m_solver.solve(main.ev, c_vcfNodes); result.proof == result.Win) {
+            move = result.move, m_score = WIN;
+        }
+    }
+    if (move == Position::npos) {
+        vector<thread> threads;
+        for (size_t id = 1; id < m_workers.size(); ++id) { // 辅助线程错开起始深度，使各线程搜索的结点不同
+            threads.emplace_back([this, id]() { deepen(*m_workers[id], 1 + int(id % 2)); });
+        }
+        deepen(main, 1);
+        m_stop.store(true, memory_order_relaxed);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        move = main.best != Position::npos ? main.best : main.rootMove; // 首层未完成时，采用已搜索部分的最好手
+        m_depth = main.depth, m_score = main.score;
+        if (move == Position::npos) {
+            move = board.getRandomMove();
+        }
+    }
+    m_nodes = m_hits = 0;
+    for (auto&& worker : m_workers) {
+        m_nodes += worker->nodes;
+        m_hits += worker->hits;
+    }
+    m_duration = duration_cast<milliseconds>(Clock::now() - m_start);
+    if (m_timer) {
+        m_timer->finish();
+    }
+    return move;
+}
+
+void AlphaBeta::reset() {
+    for (size_t i = 0; i <= m_mask; ++i) {
+        m_table[i].check.store(0, memory_order_relaxed);
+        m_table[i].data.store(0, memory_order_relaxed);
+    }
+    for (auto&& worker : m_workers) {
+        for (auto& history : worker->history) {
+            std::fill(std::begin(history), std::end(history), 0);
+        }
+    }
+    m_solver.clear();
+    if (m_timer) {
+        m_timer->reset();
+    }
+}
+
+}
@@ -2,31 +2,86 @@
 #include <string>
 #include <sstream>
 #include <random>
+#include <algorithm>
 
 using namespace std;
 using Eigen::VectorXf;
 
 namespace Gomoku {
 
-static uniform_int_distribution<unsigned> rnd(0, BOARD_SIZE - 1); // 注意区间是[a, b]!
-static mt19937 rnd_eng((random_device())());
 static ostringstream oss;
 
 /* ------------------- Position类实现 ------------------- */
 
 const Position Position::npos = -1;
 
+/* ------------------- Bitboard相关实现 ------------------- */
+
+// 格点在某一方向上所属的线号（Board::m_lines的下标）与线内的位号
+struct LineSlot {
+    std::uint8_t line, bit;
+};
+
+// 各格点在(1, 0)、(0, 1)、(1, 1)、(-1, 1)四个方向上的LineSlot。线依次为横线、竖线、两种斜线。
+static constexpr auto LineSlots = []() {
+    array<array<LineSlot, 4>, BOARD_SIZE> slots = {};
+    for (int id = 0; id < BOARD_SIZE; ++id) {
+        int x = id % WIDTH, y = id / WIDTH;
+        slots[id][0] = { uint8_t(y), uint8_t(x) };
+        slots[id][1] = { uint8_t(HEIGHT + x), uint8_t(y) };
+        slots[id][2] = { uint8_t(HEIGHT + WIDTH + (x - y + HEIGHT - 1)), uint8_t(y) };
+        slots[id][3] = { uint8_t(HEIGHT + WIDTH + (WIDTH + HEIGHT - 1) + (x + y)), uint8_t(y) };
+    }
+    return slots;
+}();
+
+// 线上覆盖第bit位的连续置位段的长度，要求该位已置位。
+// 向上数~word >> bit的末尾0个数；向下将第bit位移至最高位后，数~(word << (31 - bit))的前导0个数，移入的0取反后恰好截断计数。
+inline int RunThrough(uint32_t word, int bit) {
+    const uint32_t above = ~word >> bit, below = ~(word << (31 - bit)); // 两者都至少有一位为1
+#ifdef _MSC_VER
+    unsigned long high;
+    _BitScanReverse(&high, below);
+    return Bitboard::LowestBit(above) + (31 - int(high)) - 1;
+#else
+    return Bitboard::LowestBit(above) + __builtin_clz(below) - 1;
+#endif
+}
+
 /* ------------------- Board类实现 ------------------- */
 
 // 由于是内联使用，不暴露成外部接口，因此无需进行额外参数检查，下同
 inline void setState(Board* board, Player player, Position position) {
-    board->moveStates(player)[position] = true;
+    if (player == Player::None) { // 追加回空位集合末尾
+        auto count = board->moveCounts(Player::None);
+        board->m_freeCells[count] = CellIndex(position.id);
+        board->m_freeIndices[position] = CellIndex(count);
+    }
+    board->m_moveStates[static_cast<int>(player) + 1][position] = true;
     board->moveCounts(player) += 1;
+    if (player != Player::None) {
+        auto& lines = board->m_lines[(static_cast<int>(player) + 1) / 2];
+        for (auto [line, bit] : LineSlots[position]) {
+            lines[line] |= 1 << bit;
+        }
+    }
 }
 
 inline void unsetState(Board* board, Player player, Position position) {
-    board->moveStates(player)[position] = false;
+    if (player == Player::None) { // 与空位集合的末项交换后移除
+        auto index = board->m_freeIndices[position];
+        auto last = board->m_freeCells[board->moveCounts(Player::None) - 1];
+        board->m_freeCells[index] = last;
+        board->m_freeIndices[last] = index;
+    }
+    board->m_moveStates[static_cast<int>(player) + 1][position] = false;
     board->moveCounts(player) -= 1;
+    if (player != Player::None) {
+        auto& lines = board->m_lines[(static_cast<int>(player) + 1) / 2];
+        for (auto [line, bit] : LineSlots[position]) {
+            lines[line] &= ~(1 << bit);
+        }
+    }
 }
 
 Board::Board() {
@@ -65,16 +120,13 @@ Position Board::getRandomMove() const {
     if (moveCounts(Player::None) == 0) {
         throw overflow_error("board is already full");
     }
-    int id = rnd(rnd_eng);
-    while (!moveState(Player::None, id)) {
-        id = (id + 1) % moveStates(Player::None).size();
-    }
-    return Position(id);
+    auto index = RandomEngine::Local().below(uint32_t(moveCounts(Player::None)));
+    return Position(m_freeCells[index]);
 }
 
 Position Board::getRandomMove(Eigen::Ref<VectorXf> probs) const {
     auto distribution = discrete_distribution<int>(probs.data(), probs.data() + probs.size());
-    return distribution(rnd_eng);
+    return distribution(RandomEngine::Local());
 }
 
 bool Board::checkMove(Position move) const {
@@ -96,33 +148,15 @@ bool Board::checkGameEnd() {
         return false;
     }
 
-    // 获取最后一手的坐标
-    //const auto [curX, curY] = m_moveRecord.back();
-    const auto curX = m_moveRecord.back().x();
-    const auto curY = m_moveRecord.back().y();
+    // 只有经过最后一手的连珠才可能是新成的五连
+    const auto last_move = m_moveRecord.back();
     const auto lastPlayer = -m_curPlayer;
-
-    // 沿不同方向的搜索方法复用
-    const auto search = [curX, curY, lastPlayer, this](int dx, int dy) {
-        int renju = 1; // 当前落子构成的最大连珠数
-
-        // 正向与反向搜索
-        for (int sgn : {1, -1}) {
-            int x = curX, y = curY;
-            for (int i = 1; i <= MAX_RENJU; ++i) {
-                x += sgn * dx, y += sgn * dy;
-                // 判断坐标的格子是否未越界且归属为当前棋子
-                if (checkBoundary(x, y) && 
-                    moveState(lastPlayer, {x, y})) ++renju;
-                else break;
-            }
-        }
-
-        return renju >= MAX_RENJU;
+    const auto search = [this, last_move, lastPlayer](int d) {
+        return runLength(last_move, lastPlayer, d) >= MAX_RENJU;
     };
 
     // 从 左->右 || 下->上 || 左上->右下 || 左下->右上 进行搜索
-    if (search(1, 0) || search(0, 1) || search(1, -1) || search(1, 1)) {
+    if (search(0) || search(1) || search(2) || search(3)) {
         m_winner = lastPlayer; // 赢家为下最后一手的玩家
         m_curPlayer = Player::None;
         return true;
@@ -135,11 +169,33 @@ bool Board::checkGameEnd() {
     }
 }
 
+int Board::runLength(Position pose, Player player, int dir) const {
+    auto [line, bit] = LineSlots[pose][dir];
+    const uint32_t word = m_lines[(static_cast<int>(player) + 1) / 2][line];
+    return word >> bit & 1 ? RunThrough(word, bit) : 0;
+}
+
+bool Board::completesFive(Position pose, Player player) const {
+    const auto& lines = m_lines[(static_cast<int>(player) + 1) / 2];
+    for (auto [line, bit] : LineSlots[pose]) {
+        if (RunThrough(lines[line] | 1u << bit, bit) >= MAX_RENJU) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void Board::reset() {
     for (auto player : { Player::Black, Player::None, Player::White }) {
-        moveStates(player).fill(player == Player::None ? true : false);
+        m_moveStates[static_cast<int>(player) + 1].fill(player == Player::None ? true : false);
         moveCounts(player) = (player == Player::None ? GameConfig::BOARD_SIZE : 0);
     }
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        m_freeCells[i] = m_freeIndices[i] = CellIndex(i);
+    }
+    for (auto& lines : m_lines) {
+        lines.fill(0);
+    }
     m_moveRecord.clear();
     m_curPlayer = Player::Black;
     m_winner = Player::None;
@@ -151,6 +207,67 @@ string Board::toString() const {
 }
 #pragma optimize("", on)
 
+/* ------------------- RolloutBoard类实现 ------------------- */
+
+RolloutBoard::RolloutBoard(const Board& board) : 
+    m_lines{ board.m_lines[0], board.m_lines[1] },
+    m_freeCells(board.m_freeCells),
+    m_freeCount(int(board.moveCounts(Player::None))),
+    m_curPlayer(board.m_curPlayer), 
+    m_winner(board.m_winner) { }
+
+tuple<Player, int> RolloutBoard::play(RandomEngine& engine) {
+    int total_moves = 0;
+    for (; m_curPlayer != Player::None && m_freeCount != 0; ++total_moves, m_curPlayer = -m_curPlayer) {
+        // 随机取出一个空位，与末项交换后移除
+        const auto index = engine.below(uint32_t(m_freeCount));
+        const Position move = m_freeCells[index];
+        m_freeCells[index] = m_freeCells[--m_freeCount];
+        auto& lines = m_lines[(static_cast<int>(m_curPlayer) + 1) / 2];
+        for (auto [line, bit] : LineSlots[move]) {
+            lines[line] |= 1 << bit;
+            if (RunThrough(lines[line], bit) >= MAX_RENJU) {
+                m_winner = m_curPlayer;
+                m_curPlayer = Player::None;
+                return { m_winner, total_moves + 1 };
+            }
+        }
+    }
+    m_curPlayer = Player::None; // 下满而无人成五，为和局
+    return { m_winner, total_moves };
+}
+
+array<int, 3> RolloutBoard::PlayMany(const Board& board, int count, RandomEngine& engine) {
+    array<int, 3> results = {};
+    const RolloutBoard origin(board);
+    RolloutBoard rollout = origin;
+    for (int i = 0; i < count; ++i, rollout = origin) {
+        results[static_cast<int>(get<0>(rollout.play(engine))) + 1] += 1;
+    }
+    return results;
+}
+
+/* ------------------- RandomEngine类实现 ------------------- */
+
+RandomEngine& RandomEngine::Local() {
+    thread_local RandomEngine engine; // 线程局部，以支持多线程搜索
+    return engine;
+}
+
+RandomEngine::RandomEngine() 
+    : RandomEngine(uint64_t(random_device()()) << 32 | random_device()()) {
+
+}
+
+RandomEngine::RandomEngine(uint64_t seed) {
+    for (auto& state : m_state) { // SplitMix64
+        uint64_t z = (seed += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        state = z ^ (z >> 31);
+    }
+}
+
 }
 
 using namespace Gomoku;
@@ -1,7 +1,14 @@
 #include "MCTS.h"
+#include "Transposition.h"
 #include "algorithms/MonteCarlo.hpp"
 #include "policies/Random.h"
 #include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <stdexcept>
+#include <algorithm>
 
 using namespace std;
 using namespace std::chrono;
@@ -13,14 +20,385 @@ using Algorithms::Default;
 using Algorithms::Stats;
 using Policies::RandomPolicy;
 
+/* ------------------- NodePool类实现 ------------------- */
+
+// 内存块头部。块内的所有结点属于同一个池的同一个分桶。
+struct NodePool::Chunk {
+    NodePool* owner;
+    std::size_t bucket;
+};
+
+// 当前线程是否为Reclaimer的回收线程
+static bool& Reclaiming() {
+    thread_local bool reclaiming = false;
+    return reclaiming;
+}
+
+NodePool::~NodePool() {
+    collectRemote();
+    assert(m_size == 0);
+    for (auto chunk : m_chunks) {
+        ::operator delete(chunk, std::align_val_t(ChunkSize));
+    }
+}
+
+NodePool*& NodePool::Current() {
+    thread_local NodePool* current = nullptr;
+    return current;
+}
+
+NodePool& NodePool::Default() {
+    static NodePool* pool = new NodePool; // 有意不释放，以免静态析构顺序使池先于结点失效
+    return *pool;
+}
+
+void* NodePool::Allocate(std::size_t size) {
+    auto pool = Current();
+    auto& owner = pool ? *pool : Default();
+    ++owner.m_size, ++owner.m_allocated;
+    return owner.allocate(size);
+}
+
+void NodePool::Deallocate(void* ptr) {
+    auto& owner = Owner(ptr);
+    if (Reclaiming()) {
+        return owner.deallocateRemote(ptr, true);
+    }
+    --owner.m_size;
+    owner.deallocate(ptr);
+}
+
+void* NodePool::AllocateBuffer(std::size_t size) {
+    auto pool = Current();
+    return (pool ? *pool : Default()).allocate(size);
+}
+
+void NodePool::DeallocateBuffer(void* ptr) {
+    if (Reclaiming()) {
+        return Owner(ptr).deallocateRemote(ptr, false);
+    }
+    Owner(ptr).deallocate(ptr);
+}
+
+bool NodePool::Exhausted() {
+    auto pool = Current();
+    return (pool ? *pool : Default()).exhausted();
+}
+
+NodePool& NodePool::Owner(void* ptr) {
+    // 内存块按ChunkSize对齐，抹去低位即可找到头部
+    return *reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(ChunkSize - 1))->owner;
+}
+
+std::size_t NodePool::BucketOf(std::size_t size) {
+    if (size <= SmallBlockSize) {
+        return (size + Granularity - 1) / Granularity - 1;
+    }
+    auto bucket = SmallBuckets;
+    for (auto block_size = 2 * SmallBlockSize; block_size < size; block_size *= 2) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+std::size_t NodePool::BlockSize(std::size_t bucket) {
+    return bucket < SmallBuckets ? (bucket + 1) * Granularity : (2 * SmallBlockSize) << (bucket - SmallBuckets);
+}
+
+void* NodePool::allocate(std::size_t size) {
+    const auto bucket = BucketOf(size);
+    if (bucket >= Buckets) {
+        throw bad_alloc();
+    }
+    m_bytes += BlockSize(bucket);
+    if (m_freeLists[bucket] == nullptr && m_remoteFrees.load(memory_order_relaxed) != nullptr) {
+        collectRemote();
+    }
+    if (auto block = m_freeLists[bucket]; block != nullptr) { // 优先复用已释放的块
+        m_freeLists[bucket] = *static_cast<void**>(block);
+        return block;
+    }
+    auto& [cursor, end] = m_cursors[bucket];
+    const auto block_size = BlockSize(bucket);
+    if (end - cursor < static_cast<std::ptrdiff_t>(block_size)) { // 当前内存块已切分完毕，申请新的一整块
+        auto chunk = static_cast<Chunk*>(::operator new(ChunkSize, std::align_val_t(ChunkSize)));
+        chunk->owner = this, chunk->bucket = bucket;
+        m_chunks.push_back(chunk);
+        // 头部占用的空间按分桶粒度对齐，以保证块内切分出的结点的对齐
+        constexpr auto header_size = (sizeof(Chunk) + Granularity - 1) / Granularity * Granularity;
+        cursor = reinterpret_cast<char*>(chunk) + header_size;
+        end = reinterpret_cast<char*>(chunk) + ChunkSize;
+    }
+    auto block = cursor;
+    cursor += block_size;
+    return block;
+}
+
+void NodePool::deallocate(void* ptr) {
+    auto bucket = reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(ChunkSize - 1))->bucket;
+    m_bytes -= BlockSize(bucket);
+    *static_cast<void**>(ptr) = m_freeLists[bucket];
+    m_freeLists[bucket] = ptr;
+}
+
+void NodePool::deallocateRemote(void* ptr, bool node) {
+    auto bucket = reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(ChunkSize - 1))->bucket;
+    m_remoteNodes.fetch_add(node, memory_order_relaxed);
+    m_remoteBytes.fetch_add(BlockSize(bucket), memory_order_relaxed);
+    auto head = m_remoteFrees.load(memory_order_relaxed);
+    do {
+        *static_cast<void**>(ptr) = head;
+    } while (!m_remoteFrees.compare_exchange_weak(head, ptr, memory_order_release, memory_order_relaxed));
+}
+
+void NodePool::collectRemote() {
+    // 计数与链表分别结算：计数先于入链表增加，因此已结算的计数总是不少于已取回的块
+    m_size -= m_remoteNodes.exchange(0, memory_order_relaxed);
+    m_bytes -= m_remoteBytes.exchange(0, memory_order_relaxed);
+    for (auto block = m_remoteFrees.exchange(nullptr, memory_order_acquire); block != nullptr; ) {
+        auto next = *static_cast<void**>(block);
+        auto bucket = reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(block) & ~(ChunkSize - 1))->bucket;
+        *static_cast<void**>(block) = m_freeLists[bucket];
+        m_freeLists[bucket] = block;
+        block = next;
+    }
+}
+
+/* ------------------- Reclaimer类实现 ------------------- */
+
+Reclaimer::Reclaimer() : m_thread(&Reclaimer::run, this) { }
+
+Reclaimer::~Reclaimer() {
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeup.notify_one();
+    m_thread.join();
+}
+
+void Reclaimer::discard(unique_ptr<Node> node) {
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queue.push_back(std::move(node));
+    }
+    m_wakeup.notify_one();
+}
+
+void Reclaimer::wait() {
+    unique_lock<mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_queue.empty() && !m_busy; });
+}
+
+void Reclaimer::run() {
+    Reclaiming() = true; // 本线程归还的块一律经由远程链表
+    vector<unique_ptr<Node>> batch;
+    unique_lock<mutex> lock(m_mutex);
+    while (true) {
+        m_wakeup.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty()) { // 仅在m_stop且已无待销毁的子树时退出
+            break;
+        }
+        batch.swap(m_queue);
+        m_busy = true;
+        lock.unlock();
+        batch.clear(); // 在锁外销毁，不阻塞discard
+        lock.lock();
+        m_busy = false;
+        m_idle.notify_all();
+    }
+}
+
+/* ------------------- SearchStats类实现 ------------------- */
+
+SearchStats& SearchStats::operator+=(const SearchStats& other) {
+    for (int i = 0; i < Phases; ++i) {
+        time[i] += other.time[i];
+        calls[i] += other.calls[i];
+    }
+    nodes += other.nodes;
+    expansions += other.expansions;
+    children += other.children;
+    depth += other.depth;
+    maxDepth = std::max(maxDepth, other.maxDepth);
+    applies += other.applies;
+    reverts += other.reverts;
+    cacheHits += other.cacheHits;
+    cacheMisses += other.cacheMisses;
+    return *this;
+}
+
+/* ------------------- TimeManager类实现 ------------------- */
+
+TimeManager::TimeManager(milliseconds total, milliseconds min_move, milliseconds max_move, size_t c_movesToGo) :
+    c_total(total), c_minMove(min_move), c_maxMove(max_move), c_movesToGo(c_movesToGo), m_remaining(total) {
+    if (min_move > max_move) {
+        throw invalid_argument("min_move should not exceed max_move");
+    }
+}
+
+void TimeManager::start() {
+    m_start = Clock::now();
+    auto share = milliseconds(m_remaining.count() / std::max<long long>(c_movesToGo, 1));
+    m_budget = std::min(std::clamp(share, c_minMove, c_maxMove), m_remaining);
+    m_extension = std::max(std::min({ 2 * m_budget, c_maxMove, m_remaining }), m_budget);
+    m_deadline = m_start + m_budget;
+    m_stoppedEarly = m_extended = false;
+}
+
+bool TimeManager::shouldStop(size_t playouts, size_t best, size_t second) {
+    auto now = Clock::now();
+    if (now >= m_deadline) {
+        // 只延长一次，且仅在两者接近时
+        if (!m_extended && m_extension > m_budget && best > 0 && second >= c_closeRatio * best) {
+            m_extended = true;
+            m_deadline = m_start + m_extension;
+            return now >= m_deadline;
+        }
+        return true;
+    }
+    auto elapsed = now - m_start;
+    if (elapsed < c_minMove || playouts == 0) {
+        return false;
+    }
+    // 按目前的速度估计截止前还能完成的Playout数
+    double reachable = double(playouts) * (m_deadline - now).count() / elapsed.count();
+    m_stoppedEarly = best - second > reachable;
+    return m_stoppedEarly;
+}
+
+void TimeManager::finish() {
+    m_spent = duration_cast<milliseconds>(Clock::now() - m_start);
+    m_remaining = std::max(m_remaining - m_spent, 0ms);
+}
+
+void TimeManager::reset() {
+    m_remaining = c_total;
+    m_budget = m_spent = 0ms;
+    m_stoppedEarly = m_extended = false;
+}
+
+/* ------------------- ChildList类实现 ------------------- */
+
+ChildList::ChildList(ChildList&& other) noexcept
+    : m_nodes(other.m_nodes), m_size(other.m_size), m_pending(other.m_pending), m_capacity(other.m_capacity) {
+    other.m_nodes = nullptr, other.m_size = other.m_pending = other.m_capacity = 0;
+}
+
+ChildList& ChildList::operator=(ChildList&& other) noexcept {
+    ChildList list(std::move(other)); // 原有的子结点随list一同销毁
+    std::swap(m_nodes, list.m_nodes);
+    std::swap(m_size, list.m_size);
+    std::swap(m_pending, list.m_pending);
+    std::swap(m_capacity, list.m_capacity);
+    return *this;
+}
+
+ChildList::~ChildList() {
+    for (auto child : *this) {
+        delete child; // 已被release的位置为空指针，delete无操作
+    }
+    if (m_nodes != nullptr) {
+        NodePool::DeallocateBuffer(m_nodes);
+    }
+}
+
+std::size_t ChildList::BufferSize(std::size_t capacity) {
+    return capacity * (sizeof(Node*) + 2 * sizeof(float) + sizeof(std::uint32_t) + sizeof(Position));
+}
+
+void ChildList::reserve(std::size_t capacity) {
+    if (capacity <= m_capacity) {
+        return;
+    }
+    capacity = (capacity + 3) / 4 * 4;
+    ChildList list;
+    list.m_nodes = static_cast<Node**>(NodePool::AllocateBuffer(BufferSize(capacity)));
+    list.m_capacity = capacity;
+    list.m_size = m_size;
+    list.m_pending = m_pending;
+    const auto entries = m_size + m_pending;
+    copy_n(m_nodes, m_size, list.m_nodes);
+    copy_n(positions(), entries, list.positions());
+    copy_n(priors(), entries, list.priors());
+    copy_n(values(), entries, list.values());
+    copy_n(visits(), entries, list.visits());
+    m_size = 0; // 子结点的所有权已转移至新的缓冲区
+    *this = std::move(list);
+}
+
+void ChildList::emplace_back(unique_ptr<Node> child) {
+    if (m_size + m_pending == m_capacity) {
+        reserve(max<size_t>(4, 2 * m_capacity));
+    }
+    const auto i = m_size++;
+    if (m_pending != 0) { // 腾出首个登记项的位置，将其移至末尾
+        positions()[i + m_pending] = positions()[i];
+        priors()[i + m_pending] = priors()[i];
+        values()[i + m_pending] = values()[i];
+        visits()[i + m_pending] = visits()[i];
+    }
+    child->index = i;
+    positions()[i] = child->position;
+    m_nodes[i] = child.release();
+    sync(m_nodes[i]);
+}
+
+void ChildList::defer(Position pose, float prior) {
+    if (m_size + m_pending == m_capacity) {
+        reserve(max<size_t>(4, 2 * m_capacity));
+    }
+    const auto i = m_size + m_pending++;
+    positions()[i] = pose;
+    priors()[i] = prior;
+    values()[i] = 0.0f;
+    visits()[i] = 0;
+}
+
+void ChildList::materialize(unique_ptr<Node> child) {
+    assert(m_pending != 0 && positions()[m_size] == child->position);
+    --m_pending;
+    const auto i = m_size++;
+    child->index = i;
+    m_nodes[i] = child.release();
+    sync(m_nodes[i]);
+}
+
+unique_ptr<Node> ChildList::release(std::size_t i) {
+    return unique_ptr<Node>(std::exchange(m_nodes[i], nullptr));
+}
+
+void ChildList::restore(unique_ptr<Node> child) {
+    const auto i = child->index;
+    assert(i < m_size && m_nodes[i] == nullptr && positions()[i] == child->position);
+    m_nodes[i] = child.release();
+    sync(m_nodes[i]);
+}
+
+void ChildList::swap(std::size_t i, std::size_t j) {
+    std::swap(m_nodes[i], m_nodes[j]);
+    std::swap(positions()[i], positions()[j]);
+    std::swap(priors()[i], priors()[j]);
+    std::swap(values()[i], values()[j]);
+    std::swap(visits()[i], visits()[j]);
+    m_nodes[i]->index = i, m_nodes[j]->index = j;
+}
+
+void ChildList::sync(const Node* child) {
+    const auto i = child->index;
+    priors()[i] = child->action_prob;
+    values()[i] = child->state_value;
+    visits()[i] = child->node_visits;
+}
+
 /* ------------------- Policy类实现 ------------------- */
 
-Policy::Policy(SelectFunc f1, ExpandFunc f2, EvalFunc f3, UpdateFunc f4, double c_puct)
+Policy::Policy(SelectFunc f1, ExpandFunc f2, EvalFunc f3, UpdateFunc f4, double c_puct, BatchEvalFunc f5, size_t c_batchSize)
     : select(f1 ? f1 : [this](auto node) { 
         return Default::Select(this, node); 
     }),
-    expand(f2 ? f2 : [this](auto node, auto& board, auto probs) { 
-        return Default::Expand(this, node, board, std::move(probs)); 
+    expand(f2 ? f2 : [this](auto node, auto& board, const auto& probs) { 
+        return Default::Expand(this, node, board, probs); 
     }),
     simulate(f3 ? f3 : [this](auto& board) { 
         return Default::Simulate(this, board); 
@@ -28,7 +406,9 @@ Policy::Policy(SelectFunc f1, ExpandFunc f2, EvalFunc f3, UpdateFunc f4, double
     backPropogate(f4 ? f4 : [this](auto node, auto& board, auto value) { 
         return Default::BackPropogate(this, node, board, value); 
     }), 
-    c_puct(c_puct) { 
+    simulateBatch(f5),
+    c_puct(c_puct),
+    c_batchSize(c_batchSize) { 
 
 }
 
@@ -39,6 +419,7 @@ unique_ptr<Node> Policy::createNode(Node* parent, Position pose, Player player,
 
 void Policy::prepare(Board& board) {
     m_initActs = board.m_moveRecord.size(); // 记录棋盘起始位置
+    m_provenMove = Position::npos;
 }
 
 void Policy::cleanup(Board& board) {
@@ -59,142 +440,774 @@ bool Policy::checkGameEnd(Board& board) {
 
 /* ------------------- MCTS类实现 ------------------- */
 
-// 更新后，原根节点由unique_ptr自动释放，其余的非子树结点也会被链式自动销毁。
+// 树中的结点分别来自主内存池与各搜索线程的内存池
+inline size_t countNodes(const MCTS& mcts) {
+    auto size = mcts.m_pool->size();
+    for (auto&& pool : mcts.m_workerPools) {
+        size += pool->size();
+    }
+    return size;
+}
+
+inline size_t countBytes(const MCTS& mcts) {
+    auto bytes = mcts.m_pool->bytes();
+    for (auto&& pool : mcts.m_workerPools) {
+        bytes += pool->bytes();
+    }
+    return bytes;
+}
+
+inline size_t countAllocated(const MCTS& mcts) {
+    auto allocated = mcts.m_pool->allocated();
+    for (auto&& pool : mcts.m_workerPools) {
+        allocated += pool->allocated();
+    }
+    return allocated;
+}
+
+// 空棋盘的Zobrist哈希
+inline uint64_t emptyKey() {
+    static const uint64_t key = TranspositionTable::Hash(Board());
+    return key;
+}
+
+// 销毁丢弃的子树，其内存归还至内存池。启用异步回收时，改由回收线程销毁。
+inline void discardTree(MCTS& mcts, unique_ptr<Node> node) {
+    if (mcts.c_asyncReclaim) {
+        if (mcts.m_reclaimer == nullptr) {
+            mcts.m_reclaimer = make_unique<Reclaimer>();
+        }
+        mcts.m_reclaimer->discard(std::move(node));
+    }
+    node.reset();
+}
+
+// 更新后，原根节点连同其余的非子树结点一并丢弃；启用祖先链时则压入祖先链，超出c_historyDepth层的最远祖先才被丢弃。
 inline Node* updateRoot(MCTS& mcts, unique_ptr<Node>&& next_node) {
-    mcts.m_root = std::move(next_node);
-    mcts.m_root->parent = nullptr;
+    next_node->parent = nullptr;
+    auto prev_root = std::exchange(mcts.m_root, std::move(next_node));
+    if (mcts.m_depth != SIZE_MAX) {
+        ++mcts.m_depth;
+    }
+    mcts.m_rootKey = TranspositionTable::HashMove(mcts.m_rootKey, mcts.m_root->position, mcts.m_root->player);
+    if (mcts.c_historyDepth == 0) {
+        discardTree(mcts, std::move(prev_root));
+    } else {
+        auto& history = mcts.m_history;
+        history.push_back(std::move(prev_root));
+        if (history.size() > mcts.c_historyDepth) {
+            const auto excess = history.size() - mcts.c_historyDepth;
+            for (size_t i = 0; i < excess; ++i) {
+                discardTree(mcts, std::move(history[i]));
+            }
+            history.erase(history.begin(), history.begin() + excess);
+        }
+    }
+    mcts.m_size = countNodes(mcts);
+    mcts.m_memory = countBytes(mcts);
     return mcts.m_root.get();
 }
 
+// 在node之下寻找由owner中登记的各手（owner[i]为在i处落子的玩家，未登记处为None）以任意次序组成的已有路径。
+// 取最深者，同深度时取末端访问次数最多者，记入best。
+static void findTransposition(const Node* node, array<Player, BOARD_SIZE>& owner, 
+                              vector<Position>& path, pair<vector<Position>, size_t>& best) {
+    if (path.size() > best.first.size() || (path.size() == best.first.size() && node->node_visits > best.second)) {
+        best = { path, node->node_visits };
+    }
+    for (auto child : node->children) {
+        if (owner[child->position] != child->player) {
+            continue;
+        }
+        owner[child->position] = Player::None; // 同一路径上每手至多出现一次
+        path.push_back(child->position);
+        findTransposition(child, owner, path, best);
+        path.pop_back();
+        owner[child->position] = child->player;
+    }
+}
+
+// 折叠访问次数少于threshold的子树，使其重新成为叶结点。根结点自身的子结点集合总是保留。
+inline void pruneSubtrees(Node* node, size_t threshold) {
+    for (auto child : node->children) {
+        if (child->node_visits < threshold) {
+            child->children = ChildList();
+        } else {
+            pruneSubtrees(child, threshold);
+        }
+    }
+}
+
 MCTS::MCTS(
     milliseconds c_duration,
     Position last_move,
     Player last_player,
-    shared_ptr<Policy> policy
+    shared_ptr<Policy> policy,
+    size_t c_threads
 ) :
     m_policy(policy ? policy : shared_ptr<Policy>(new RandomPolicy)),
-    m_root(m_policy->createNode(nullptr, last_move, last_player, 0.0, 1.0)),
+    m_pool(make_unique<NodePool>()),
     m_size(1),
     m_iterations(0),
     m_duration(c_duration),
     c_constraint(Constraint::Duration) { 
-    
+    initialize(last_move, last_player, c_threads);
 }
 
 MCTS::MCTS(
     size_t   c_iterations,
     Position last_move,
     Player   last_player,
-    shared_ptr<Policy> policy
+    shared_ptr<Policy> policy,
+    size_t   c_threads
 ) :
     m_policy(policy ? policy : shared_ptr<Policy>(new RandomPolicy)),
-    m_root(m_policy->createNode(nullptr, last_move, last_player, 0.0, 1.0)),
+    m_pool(make_unique<NodePool>()),
     m_size(1),
     m_iterations(c_iterations),
     m_duration(0ms),
     c_constraint(Constraint::Iterations) {
-
+    initialize(last_move, last_player, c_threads);
 };
 
+void MCTS::initialize(Position last_move, Player last_player, size_t c_threads) {
+    if (c_threads > 1) { // 每个线程（包括调用线程）各持有一份策略副本与内存池
+        for (size_t i = 0; i < c_threads; ++i) {
+            auto worker = m_policy->clone();
+            if (worker == nullptr) {
+                throw invalid_argument("policy does not support clone(), which parallel search requires");
+            }
+            worker->m_parallel = worker->m_virtualLoss = true;
+            m_workers.push_back(std::move(worker));
+            m_workerPools.push_back(make_unique<NodePool>());
+        }
+    }
+    NodePool::Scope scope(*m_pool);
+    m_root = m_policy->createNode(nullptr, last_move, last_player, 0.0, 1.0);
+    m_depth = last_move == Position::npos ? 0 : SIZE_MAX;
+    m_rootKey = emptyKey();
+}
+
+MCTS::~MCTS() {
+    stopPondering();
+}
+
 Position MCTS::getAction(Board& board) {
     runPlayouts(board);
-    return stepForward()->position;
+    return (m_provenMove != Position::npos ? stepForward(m_provenMove) : stepForward())->position;
 }
 
-Policy::EvalResult MCTS::evalState(Board& board) {
-    runPlayouts(board);
-    Eigen::VectorXf child_visits;
-    child_visits.setZero((int)BOARD_SIZE);
-    for (auto&& node : m_root->children) {
-        child_visits[node->position] = node->node_visits;
-    }
-    cout << Eigen::Map<const Eigen::Array<float, 15, 15, Eigen::RowMajor>>(child_visits.data()) << endl;
+// 根据根结点各子结点的访问次数求出落子概率
+inline Policy::EvalResult evalVisits(Eigen::VectorXf child_visits, float state_value, const Board& board) {
 	child_visits = child_visits.normalized().unaryExpr([](float v) { return v ? v + 1 : v; });
     auto action_probs = Stats::TempBasedProbs(
         child_visits, board.m_moveRecord.size() < 15 ? 1 : 1e-2 
     );
-    return { m_root->state_value, action_probs };
+    return { state_value, action_probs };
+}
+
+Eigen::VectorXf MCTS::rootVisits(Board& board) {
+    runPlayouts(board);
+    Eigen::VectorXf child_visits;
+    child_visits.setZero((int)BOARD_SIZE);
+    const auto& children = m_root->children;
+    for (size_t i = 0; i < children.size(); ++i) {
+        child_visits[children.positions()[i]] = children.visits()[i];
+    }
+    if (m_provenMove != Position::npos) { // 未进行Playout时，以必胜手作为唯一的访问
+        child_visits.setZero();
+        child_visits[m_provenMove] = 1.0f;
+    }
+    return child_visits;
+}
+
+Policy::EvalResult MCTS::evalState(Board& board) {
+    auto child_visits = rootVisits(board);
+    return evalVisits(std::move(child_visits), m_root->state_value, board);
 }
 
 void MCTS::syncWithBoard(Board & board) {
-    auto iter = std::find(board.m_moveRecord.begin(), board.m_moveRecord.end(), m_root->position);
-    for (iter = (iter == board.m_moveRecord.end() ? board.m_moveRecord.begin() : ++iter);
-        iter != board.m_moveRecord.end(); ++iter) {
-        stepForward(*iter);
+    stopPondering();
+    const auto& record = board.m_moveRecord;
+    auto mover = [](size_t i) { return i % 2 == 0 ? Player::Black : Player::White; }; // 第i手的落子方
+    vector<uint64_t> prefix(record.size() + 1, emptyKey()); // prefix[t]为棋谱前t手后局面的哈希
+    for (size_t i = 0; i < record.size(); ++i) {
+        prefix[i + 1] = TranspositionTable::HashMove(prefix[i], record[i], mover(i));
+    }
+    if (m_depth == SIZE_MAX) { // 按根结点的一手在棋谱中的位置定位，找不到时视根结点为开局
+        auto iter = std::find(record.begin(), record.end(), m_root->position);
+        m_depth = iter == record.end() ? 0 : iter - record.begin() + 1;
+        m_rootKey = prefix[m_depth];
+    }
+    // 根结点不在棋谱的前缀上（悔棋、重开或换了一局）时，沿祖先链退回；祖先均不符时，换用新的根结点
+    while (m_depth > record.size() || m_rootKey != prefix[m_depth]) {
+        if (m_history.empty()) {
+            NodePool::Scope scope(*m_pool);
+            discardTree(*this, std::exchange(m_root, m_policy->createNode(nullptr, Position(-1), Player::White, 0.0f, 1.0f)));
+            m_depth = 0;
+            m_rootKey = prefix[0];
+            m_size = countNodes(*this);
+            m_memory = countBytes(*this);
+            break;
+        }
+        stepBack();
+    }
+    if (m_depth == record.size()) {
+        return;
+    }
+    // 余下的各手可能以另一种次序出现在树中，先沿访问次数最多的已有路径推进
+    array<Player, BOARD_SIZE> owner;
+    owner.fill(Player::None);
+    for (size_t i = m_depth; i < record.size(); ++i) {
+        owner[record[i]] = mover(i);
+    }
+    vector<Position> path;
+    pair<vector<Position>, size_t> best = { {}, m_root->node_visits };
+    findTransposition(m_root.get(), owner, path, best);
+    const auto start = m_depth;
+    for (auto move : best.first) {
+        owner[move] = Player::None;
+        stepForward(move);
+    }
+    // 该路径未用到的各手，按棋谱中的先后、黑白交替补齐
+    vector<Position> rest[2];
+    for (size_t i = start; i < record.size(); ++i) {
+        if (owner[record[i]] != Player::None) {
+            rest[i % 2].push_back(record[i]);
+        }
+    }
+    size_t next[2] = { 0, 0 };
+    while (m_depth < record.size()) {
+        const auto side = m_depth % 2;
+        stepForward(rest[side][next[side]++]);
     }
 }
 
 // AlphaZero的论文中，对MCTS的再利用策略
 // 参见https://stackoverflow.com/questions/47389700
 Node* MCTS::stepForward() {
-    auto iter = max_element(m_root->children.begin(), m_root->children.end(), [](auto&& lhs, auto&& rhs) {
-        return lhs->node_visits < rhs->node_visits;
-    });
-    return iter != m_root->children.end() ? updateRoot(*this, std::move(*iter)) : m_root.get();
+    stopPondering();
+    auto& children = m_root->children;
+    if (children.empty()) {
+        return m_root.get();
+    }
+    auto index = max_element(children.visits(), children.visits() + children.size()) - children.visits();
+    return updateRoot(*this, children.release(index));
 }
 
 Node* MCTS::stepForward(Position next_move) {
-    auto iter = find_if(m_root->children.begin(), m_root->children.end(), [next_move](auto&& node) {
-        return node->position == next_move;
-    });
-    if (iter == m_root->children.end()) { // 这个迷之hack是为了防止Python模块中出现引用Bug...
-        iter = m_root->children.emplace(
-            m_root->children.end(), 
-            m_policy->createNode(nullptr, next_move, -m_root->player, 0.0f, 1.0f)
-        );
+    stopPondering();
+    NodePool::Scope scope(*m_pool);
+    auto& children = m_root->children;
+    const auto entries = children.size() + children.pending();
+    size_t index = find(children.positions(), children.positions() + entries, next_move) - children.positions();
+    if (index == entries) { // 这个迷之hack是为了防止Python模块中出现引用Bug...
+        children.emplace_back(m_policy->createNode(nullptr, next_move, -m_root->player, 0.0f, 1.0f));
+        index = children.size() - 1;
+    }
+    while (children.size() <= index) { // 该手尚未创建结点，则创建至其为止
+        Default::Materialize(m_policy.get(), m_root.get());
+    }
+    return updateRoot(*this, children.release(index));
+}
+
+Node* MCTS::stepBack() {
+    stopPondering();
+    if (m_history.empty()) {
+        return m_root.get();
+    }
+    auto parent = std::move(m_history.back());
+    m_history.pop_back();
+    auto& children = parent->children;
+    parent->node_visits += m_root->node_visits - children.visits()[m_root->index]; // 成为根结点后的搜索同样计入祖先
+    if (m_depth != SIZE_MAX) {
+        --m_depth;
     }
-    return updateRoot(*this, std::move(*iter));
+    m_rootKey = TranspositionTable::HashMove(m_rootKey, m_root->position, m_root->player); // 异或两次即撤销
+    m_root->parent = parent.get();
+    children.restore(std::move(m_root));
+    m_root = std::move(parent);
+    m_size = countNodes(*this);
+    m_memory = countBytes(*this);
+    return m_root.get();
 }
 
 void MCTS::reset() {
-    auto iter = m_root->children.emplace(
-        m_root->children.end(), 
-        m_policy->createNode(nullptr, Position(-1), Player::White, 0.0f, 1.0f)
-    );
-    m_root = std::move(*iter);
-    m_size = 1;
+    stopPondering();
+    NodePool::Scope scope(*m_pool);
+    if (c_historyDepth != 0 && m_depth != SIZE_MAX && m_depth <= m_history.size()) { // 最远的祖先即为开局
+        while (m_depth > 0) {
+            stepBack();
+        }
+    } else {
+        for (auto& ancestor : m_history) {
+            discardTree(*this, std::move(ancestor));
+        }
+        m_history.clear();
+        auto& children = m_root->children;
+        children.emplace_back(m_policy->createNode(nullptr, Position(-1), Player::White, 0.0f, 1.0f));
+        m_root = children.release(children.size() - 1);
+        m_depth = 0;
+        m_rootKey = emptyKey();
+    }
+    m_size = countNodes(*this);
+    m_memory = countBytes(*this);
+    if (m_timer) {
+        m_timer->reset();
+    }
+}
+
+void MCTS::collectGarbage() {
+    if (c_memoryLimit == 0) {
+        m_pool->setBudget(SIZE_MAX);
+        for (auto&& pool : m_workerPools) {
+            pool->setBudget(SIZE_MAX);
+        }
+        return;
+    }
+    // 最远的祖先在悔棋前不会被搜索，最先丢弃（就地销毁，以便立即计入回收的内存）
+    while (!m_history.empty() && countBytes(*this) > c_memoryLimit / 2) {
+        m_history.erase(m_history.begin());
+    }
+    // 阈值每轮翻倍，直至内存降到上限的一半，或除根结点的子结点外已无可折叠的子树
+    for (size_t threshold = 1; countBytes(*this) > c_memoryLimit / 2 && threshold <= m_root->node_visits; threshold *= 2) {
+        pruneSubtrees(m_root.get(), threshold);
+    }
+    m_size = countNodes(*this);
+    m_memory = countBytes(*this);
+    const auto spare = c_memoryLimit > m_memory ? c_memoryLimit - m_memory : 0;
+    if (m_workerPools.empty()) {
+        m_pool->setBudget(m_pool->bytes() + spare);
+    } else { // 树并行搜索时，各线程只向自己的内存池分配结点，故平分剩余的上限
+        m_pool->setBudget(SIZE_MAX);
+        for (auto&& pool : m_workerPools) {
+            pool->setBudget(pool->bytes() + spare / m_workerPools.size());
+        }
+    }
 }
 
-size_t MCTS::playout(Board& board) {
+Node* MCTS::descend(Board& board, Policy& policy, SymmetricHash& hash) {
+    SearchStats::Timer timer(policy.m_stats, SearchStats::Select);
     Node* node = m_root.get();      // 裸指针用作观察指针，不对树结点拥有所有权
-    while (!node->isLeaf()) {   // 检测当前结点是否所有可行手都被拓展过
-        node = m_policy->select(node);  // 若当前结点已拓展完毕，则根据价值公式选出下一个探索结点
-        m_policy->applyMove(board, node->position);
+    size_t depth = 0;
+    for (;; ++depth) {
+        { // 树并行搜索时，对结点的选择与扩展互斥
+            auto lock = Default::LockNode(&policy, node);
+            if (node->isLeaf()) {   // 检测当前结点是否所有可行手都被拓展过
+                break;
+            }
+            if (node->children.pending() != 0 && !NodePool::Exhausted()) { // 逐步展开时，按访问次数补充创建子结点
+                Default::Widen(&policy, node);
+            }
+            node = policy.select(node);  // 若当前结点已拓展完毕，则根据价值公式选出下一个探索结点
+            if (policy.m_virtualLoss) {
+                Default::ApplyVirtualLoss(&policy, node); // 使其他线程暂时避开该结点
+            }
+        }
+        policy.applyMove(board, node->position);
+        if (m_table) {
+            hash.toggle(node->position, node->player);
+        }
     }
+    policy.m_stats.depth += depth;
+    policy.m_stats.maxDepth = std::max(policy.m_stats.maxDepth, depth);
+    return node;
+}
+
+Policy::EvalResult MCTS::evaluate(Board& board, Policy& policy, const SymmetricHash& hash) {
+    SearchStats::Timer timer(policy.m_stats, SearchStats::Simulate);
+    if (!m_table) {
+        return policy.simulate(board);
+    }
+    if (auto result = m_table->probe(hash)) {
+        return std::move(*result);
+    }
+    auto result = policy.simulate(board);
+    m_table->store(hash, result);
+    return result;
+}
+
+size_t MCTS::expand(Node* node, Board& board, Policy& policy, const VectorXf& action_probs) {
+    SearchStats::Timer timer(policy.m_stats, SearchStats::Expand);
+    auto lock = Default::LockNode(&policy, node);
+    if (!node->isLeaf() || NodePool::Exhausted()) {
+        return 0;
+    }
+    auto expand_size = policy.expand(node, board, action_probs);
+    policy.m_stats.expansions += 1;
+    policy.m_stats.children += node->children.size() + node->children.pending();
+    return expand_size;
+}
+
+size_t MCTS::playout(Board& board, Policy& policy) {
+    SymmetricHash hash = m_rootHash;
+    Node* node = descend(board, policy, hash);
     double node_value;
     size_t expand_size;
-    if (!m_policy->checkGameEnd(board)) {  // 检查终结点游戏是否结束
-        auto [state_value, action_probs] = m_policy->simulate(board); // 获取当前盘面相对于「当前应下玩家」的价值与概率分布
-        expand_size = m_policy->expand(node, board, std::move(action_probs)); // 根据传入的概率向量扩展一层结点
+    if (!policy.checkGameEnd(board)) {  // 检查终结点游戏是否结束
+        auto [state_value, action_probs] = evaluate(board, policy, hash); // 获取当前盘面相对于「当前应下玩家」的价值与概率分布
+        expand_size = expand(node, board, policy, action_probs); // 根据传入的概率向量扩展一层结点
         node_value = -state_value; // 由于node保存的是「下出变成当前局面的一手」的玩家，因此其价值应取相反数
     } else {
         expand_size = 0;
         node_value = CalcScore(node->player, board.m_winner); // 根据绝对价值(winner)获取当前局面于玩家的相对价值
     }
-    m_policy->backPropogate(node, board, node_value);     
-    m_policy->revertMove(board, board.m_moveRecord.size() - m_policy->m_initActs); // 重置回初始局面
+    SearchStats::Timer timer(policy.m_stats, SearchStats::BackPropogate);
+    policy.backPropogate(node, board, node_value);     
+    policy.revertMove(board, board.m_moveRecord.size() - policy.m_initActs); // 重置回初始局面
     return expand_size;
 }
 
+size_t MCTS::batchedPlayout(Board& board, Policy& policy, size_t max_playouts) {
+    vector<Node*> leaves;  // 待评估的叶结点
+    vector<Board> boards;  // 叶结点对应的局面
+    vector<SymmetricHash> hashes; // 叶结点局面的哈希，启用置换表时用于写入评估结果
+    Node* collision = nullptr;
+    size_t playouts = 0;
+    while (playouts < max_playouts && collision == nullptr) {
+        SymmetricHash hash = m_rootHash;
+        Node* node = descend(board, policy, hash);
+        ++playouts;
+        if (policy.checkGameEnd(board)) { // 终局无需评估，直接回传
+            SearchStats::Timer timer(policy.m_stats, SearchStats::BackPropogate);
+            policy.backPropogate(node, board, CalcScore(node->player, board.m_winner));
+        } else if (auto cached = m_table ? m_table->probe(hash) : nullopt) { // 命中置换表，同样无需评估
+            auto& [state_value, action_probs] = *cached;
+            expand(node, board, policy, action_probs);
+            SearchStats::Timer timer(policy.m_stats, SearchStats::BackPropogate);
+            policy.backPropogate(node, board, -state_value);
+        } else if (find(leaves.begin(), leaves.end(), node) != leaves.end()) {
+            collision = node; // 虚拟损失不足以使本批次避开该叶结点，说明树已难以再分散，提前结束本批次
+        } else {
+            leaves.push_back(node);
+            boards.push_back(board);
+            hashes.push_back(hash);
+        }
+        policy.revertMove(board, board.m_moveRecord.size() - policy.m_initActs); // 重置回初始局面
+    }
+    if (leaves.empty()) {
+        return playouts;
+    }
+    auto results = [&]() {
+        SearchStats::Timer timer(policy.m_stats, SearchStats::Simulate);
+        return policy.simulateBatch(boards);
+    }();
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        if (m_table) {
+            m_table->store(hashes[i], results[i]);
+        }
+        auto& [state_value, action_probs] = results[i];
+        expand(leaves[i], boards[i], policy, action_probs);
+        SearchStats::Timer timer(policy.m_stats, SearchStats::BackPropogate);
+        policy.backPropogate(leaves[i], boards[i], -state_value);
+        if (leaves[i] == collision) { // 重复抵达的Playout沿用同一评估结果
+            policy.backPropogate(leaves[i], boards[i], -state_value);
+        }
+    }
+    return playouts;
+}
+
+size_t MCTS::iterate(Board& board, Policy& policy, size_t max_playouts) {
+    if (policy.simulateBatch == nullptr) {
+        playout(board, policy);
+        return 1;
+    }
+    return batchedPlayout(board, policy, std::min(max_playouts, policy.c_batchSize));
+}
+
+bool MCTS::timeUp(TimeManager::Clock::time_point start, size_t iterations) {
+    if (m_timer == nullptr) {
+        return TimeManager::Clock::now() - start >= m_duration;
+    }
+    size_t best = 0, second = 0;
+    {
+        // 树并行时，子结点集合中的统计量受根结点的锁保护
+        auto lock = Default::LockNode(m_workers.empty() ? m_policy.get() : m_workers[0].get(), m_root.get());
+        const auto& children = m_root->children;
+        for (size_t i = 0; i < children.size(); ++i) {
+            size_t visits = children.visits()[i];
+            if (visits > best) {
+                second = best, best = visits;
+            } else if (visits > second) {
+                second = visits;
+            }
+        }
+    }
+    return m_timer->shouldStop(iterations, best, second);
+}
+
+void MCTS::runParallelPlayouts(Board& board) {
+    auto start = TimeManager::Clock::now();
+    atomic<size_t> iterations = 0;
+    atomic<bool> stop = false; // 按时间控制时，由调用线程检查时钟后通知其余线程
+    auto work = [&](size_t id) {
+        NodePool::Scope scope(*m_workerPools[id]);
+        auto& policy = *m_workers[id];
+        Board local_board = board; // 各线程使用独立的棋盘副本
+        policy.prepare(local_board);
+        if (policy.m_provenMove != Position::npos) { // 各线程的根局面相同，证明结果也相同
+            stop.store(true, memory_order_relaxed);
+            policy.cleanup(local_board);
+            return;
+        }
+        const size_t batch_size = policy.simulateBatch ? policy.c_batchSize : 1;
+        if (c_constraint == Constraint::Duration && id == 0) {
+            for (size_t done = 0, next_check = 0; ; ) {
+                if (done >= next_check) {
+                    if (timeUp(start, iterations.load(memory_order_relaxed))) {
+                        break;
+                    }
+                    next_check = done + C_CHECK_INTERVAL;
+                }
+                auto count = iterate(local_board, policy, batch_size);
+                done += count;
+                iterations.fetch_add(count, memory_order_relaxed);
+            }
+            stop.store(true, memory_order_relaxed);
+        } else if (c_constraint == Constraint::Duration) {
+            while (!stop.load(memory_order_relaxed)) {
+                iterations.fetch_add(iterate(local_board, policy, batch_size), memory_order_relaxed);
+            }
+        } else if (c_constraint == Constraint::Iterations) {
+            // 每次预领一批迭代次数，未能完成的部分（批次提前结束时）归还给其他线程
+            for (size_t claimed; (claimed = iterations.fetch_add(batch_size, memory_order_relaxed)) < m_iterations; ) {
+                auto done = iterate(local_board, policy, std::min(batch_size, m_iterations - claimed));
+                iterations.fetch_sub(batch_size - done, memory_order_relaxed);
+            }
+        }
+        policy.cleanup(local_board);
+    };
+    vector<thread> threads;
+    for (size_t id = 1; id < m_workers.size(); ++id) {
+        threads.emplace_back(work, id);
+    }
+    work(0); // 调用线程同样参与搜索
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (c_constraint == Constraint::Duration) {
+        m_iterations = iterations;
+    } else if (c_constraint == Constraint::Iterations) {
+        m_duration = duration_cast<milliseconds>(TimeManager::Clock::now() - start);
+    }
+}
+
+void MCTS::startPondering(Board board) {
+    this->syncWithBoard(board); // 同时停止尚在进行的后台搜索
+    {
+        NodePool::Scope scope(*m_pool);
+        this->collectGarbage();
+    }
+    if (m_table) {
+        m_rootHash = SymmetricHash(board);
+    }
+    m_pondering = true;
+    m_ponderer = thread(&MCTS::ponder, this, std::move(board));
+}
+
+void MCTS::stopPondering() {
+    if (m_ponderer.joinable()) {
+        m_pondering = false;
+        m_ponderer.join();
+    }
+}
+
+void MCTS::ponder(Board board) {
+    // 只使用调用线程的策略，即使构造时要求了树并行
+    NodePool::Scope scope(*m_pool);
+    m_policy->prepare(board);
+    m_policy->m_virtualLoss = m_policy->simulateBatch != nullptr;
+    m_ponderIterations = 0;
+    while (m_pondering.load(memory_order_relaxed)) {
+        m_ponderIterations += iterate(board, *m_policy, m_policy->c_batchSize);
+    }
+    m_policy->cleanup(board);
+    m_size = countNodes(*this);
+    m_memory = countBytes(*this);
+}
+
 void MCTS::runPlayouts(Board& board) {
-    auto start = system_clock::now();
+    auto start = TimeManager::Clock::now();
+    const bool timed = m_timer && c_constraint == Constraint::Duration;
+    if (timed) {
+        m_timer->start(); // 同步与回收内存的开销同样计入本步的时长
+    }
+    NodePool::Scope scope(*m_pool); // 本轮搜索中扩展的结点均分配自该树的内存池
     this->syncWithBoard(board);
+    this->collectGarbage();
 	Default::AddNoise(m_root.get());
-    m_policy->prepare(board);    
-    if (c_constraint == Constraint::Duration) {
-        m_iterations = 0;
-        for (auto end = start; end - start < m_duration; 
-            end = system_clock::now(), ++m_iterations) {
-            m_size += playout(board);
+    if (m_table) {
+        m_rootHash = SymmetricHash(board);
+    }
+    const auto allocated = countAllocated(*this);
+    m_policy->m_stats = {};
+    m_policy->m_stats.timed = c_profile;
+    for (auto&& worker : m_workers) {
+        worker->m_stats = {};
+        worker->m_stats.timed = c_profile;
+    }
+    if (!m_workers.empty()) {
+        runParallelPlayouts(board);
+    } else {
+        m_policy->prepare(board);    
+        m_policy->m_virtualLoss = m_policy->simulateBatch != nullptr; // 批量评估时，借助虚拟损失分散同一批次的Playout
+        if (m_policy->m_provenMove != Position::npos) { // 根局面已证明必胜，无需Playout
+            if (c_constraint == Constraint::Duration) {
+                m_iterations = 0;
+            } else {
+                m_duration = duration_cast<milliseconds>(TimeManager::Clock::now() - start);
+            }
+        } else if (c_constraint == Constraint::Duration) {
+            m_iterations = 0;
+            for (size_t next_check = 0; ; ) {
+                if (m_iterations >= next_check) { // 每C_CHECK_INTERVAL次Playout检查一次时钟
+                    if (timeUp(start, m_iterations)) {
+                        break;
+                    }
+                    next_check = m_iterations + C_CHECK_INTERVAL;
+                }
+                m_iterations += iterate(board, *m_policy, m_policy->c_batchSize);
+            }
+        } else if (c_constraint == Constraint::Iterations) {
+            m_duration = 0ms;
+            for (size_t i = 0; i < m_iterations; ) {
+                i += iterate(board, *m_policy, m_iterations - i);
+            }
+            m_duration = duration_cast<milliseconds>(TimeManager::Clock::now() - start);
         }
-    } else if (c_constraint == Constraint::Iterations) {
-        m_duration = 0ms;
-        for (auto i = 0; i < m_iterations; ++i) {
-            m_size += playout(board);
+        m_policy->cleanup(board);
+    }
+    if (timed) {
+        m_timer->finish();
+    }
+    m_provenMove = (m_workers.empty() ? m_policy : m_workers[0])->m_provenMove;
+    m_stats = m_policy->m_stats;
+    for (auto&& worker : m_workers) {
+        m_stats += worker->m_stats;
+    }
+    m_stats.nodes = countAllocated(*this) - allocated;
+    m_size = countNodes(*this);
+    m_memory = countBytes(*this);
+}
+
+/* ------------------- EnsembleMCTS类实现 ------------------- */
+
+// 首棵树使用传入的策略，其余各树使用其副本
+template <typename Constraint_t>
+inline vector<unique_ptr<MCTS>> createTrees(Constraint_t constraint, Position last_move, Player last_player, 
+                                            shared_ptr<Policy> policy, size_t c_trees) {
+    vector<unique_ptr<MCTS>> trees;
+    policy = policy ? policy : shared_ptr<Policy>(new RandomPolicy);
+    for (size_t i = 0; i < std::max<size_t>(c_trees, 1); ++i) {
+        auto tree_policy = i == 0 ? policy : policy->clone();
+        if (tree_policy == nullptr) {
+            throw invalid_argument("policy does not support clone(), which ensemble search requires");
         }
-        m_duration = duration_cast<milliseconds>(system_clock::now() - start);
+        trees.push_back(make_unique<MCTS>(constraint, last_move, last_player, tree_policy));
+    }
+    return trees;
+}
+
+EnsembleMCTS::EnsembleMCTS(
+    milliseconds c_duration,
+    Position last_move,
+    Player last_player,
+    shared_ptr<Policy> policy,
+    size_t c_trees
+) :
+    m_trees(createTrees(c_duration, last_move, last_player, policy, c_trees)),
+    m_size(m_trees.size()),
+    m_iterations(0),
+    m_duration(c_duration) {
+
+}
+
+EnsembleMCTS::EnsembleMCTS(
+    size_t   c_iterations,
+    Position last_move,
+    Player   last_player,
+    shared_ptr<Policy> policy,
+    size_t   c_trees
+) :
+    m_trees(createTrees(c_iterations, last_move, last_player, policy, c_trees)),
+    m_size(m_trees.size()),
+    m_iterations(c_iterations * m_trees.size()),
+    m_duration(0ms) {
+
+}
+
+Position EnsembleMCTS::getAction(Board& board) {
+    runPlayouts(board);
+    auto [child_visits, child_values, state_value] = mergeRoots();
+    Position next_move = m_trees[0]->m_provenMove; // 各树的根局面相同，证明结果也相同
+    if (next_move == Position::npos) {
+        child_visits.maxCoeff(&next_move.id);
+    }
+    for (auto&& tree : m_trees) {
+        tree->stepForward(next_move);
+    }
+    return next_move;
+}
+
+Policy::EvalResult EnsembleMCTS::evalState(Board& board) {
+    runPlayouts(board);
+    auto [child_visits, child_values, state_value] = mergeRoots();
+    if (auto proven = m_trees[0]->m_provenMove; proven != Position::npos) { // 未进行Playout时，以必胜手作为唯一的访问
+        child_visits.setZero();
+        child_visits[proven] = 1.0f;
+    }
+    return evalVisits(std::move(child_visits), state_value, board);
+}
+
+tuple<VectorXf, VectorXf, float> EnsembleMCTS::mergeRoots() const {
+    VectorXf child_visits, child_values;
+    child_visits.setZero((int)BOARD_SIZE);
+    child_values.setZero((int)BOARD_SIZE);
+    double state_value = 0.0, root_visits = 0.0;
+    for (auto&& tree : m_trees) {
+        const auto& children = tree->m_root->children;
+        for (size_t i = 0; i < children.size(); ++i) {
+            auto pose = children.positions()[i];
+            child_visits[pose] += children.visits()[i];
+            child_values[pose] += children.visits()[i] * children.values()[i];
+        }
+        state_value += tree->m_root->node_visits * tree->m_root->state_value;
+        root_visits += tree->m_root->node_visits;
+    }
+    child_values = (child_visits.array() > 0).select(child_values.array() / child_visits.array(), 0.0f);
+    return { child_visits, child_values, root_visits > 0 ? state_value / root_visits : 0.0 };
+}
+
+void EnsembleMCTS::syncWithBoard(Board& board) {
+    for (auto&& tree : m_trees) {
+        tree->syncWithBoard(board);
+    }
+}
+
+void EnsembleMCTS::reset() {
+    for (auto&& tree : m_trees) {
+        tree->reset();
+    }
+    m_size = m_trees.size();
+}
+
+void EnsembleMCTS::runPlayouts(Board& board) {
+    vector<thread> threads;
+    for (size_t i = 1; i < m_trees.size(); ++i) {
+        threads.emplace_back([this, i, local_board = board]() mutable { // 各线程使用独立的棋盘副本
+            m_trees[i]->runPlayouts(local_board);
+        });
+    }
+    m_trees[0]->runPlayouts(board); // 调用线程搜索首棵树
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    m_size = 0, m_iterations = 0, m_duration = 0ms;
+    for (auto&& tree : m_trees) {
+        m_size += tree->m_size;
+        m_iterations += tree->m_iterations;
+        m_duration = std::max(m_duration, tree->m_duration);
     }
-    m_policy->cleanup(board);
 }
 
 }
\ No newline at end of file
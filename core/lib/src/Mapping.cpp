@@ -1,7 +1,5 @@
 #include "Mapping.h"
 #include "Pattern.h"
-#include "utils/Persistence.h"
-#include <random>
 
 using namespace std;
 using namespace Gomoku;
@@ -41,6 +39,8 @@ Player BoardMap::applyMove(Position move) {
     }
 	m_hash ^= BoardHash::HashPose(move, Player::None);
 	m_hash ^= BoardHash::HashPose(move, m_board->m_curPlayer);
+	m_symmetry.toggle(move, m_board->m_curPlayer);
+    m_features.applyMove(move, m_board->m_curPlayer, m_board->m_moveRecord);
     return m_board->applyMove(move, false);
 }
 
@@ -54,12 +54,16 @@ Player BoardMap::revertMove(size_t count) {
         m_board->revertMove();
 		m_hash ^= BoardHash::HashPose(move, m_board->m_curPlayer);
 		m_hash ^= BoardHash::HashPose(move, Player::None);
+		m_symmetry.toggle(move, m_board->m_curPlayer);
+        m_features.revertMove(move, m_board->m_curPlayer, m_board->m_moveRecord);
     }
     return m_board->m_curPlayer;
 }
 
 void BoardMap::reset() {
     m_hash = 0ul;
+    m_symmetry = SymmetricHash();
+    m_features = FeaturePlanes();
     m_board->reset();
     for (auto& line : m_lineMap) {
         line.resize(MAX_PATTERN_LEN - 1, EncodeCharset('?')); // ǰԽλ('?')
@@ -76,21 +80,85 @@ void BoardMap::reset() {
     }
 }
 
-/* ------------------- BoardHashʵ ------------------- */
+/* ------------------- FeaturePlanesʵ ------------------- */
 
-const array<std::uint64_t[3], BOARD_SIZE> BoardHash::Zorbrist = []() {
-	array<std::uint64_t[3], BOARD_SIZE> keys;
-	auto data = Persistence::Load("zobrist");
-	if (data.is_null()) {
-		uniform_int_distribution<std::uint64_t> rnd;
-		mt19937_64 eng((random_device())()); // 64λ
-		for (int i = 0; i < BOARD_SIZE; ++i) {
-			data.push_back({ rnd(eng), rnd(eng), rnd(eng) });
-		}
-		Persistence::Save("zobrist", data); // dataǺܴ滹Ҫãʲmove
+constexpr int LastMove = 3, SecondLastMove = 4;
+
+FeaturePlanes::FeaturePlanes() : m_curPlayer(Player::Black) {
+    for (auto& plane : m_planes) {
+        plane.fill(0);
+    }
+    m_planes[static_cast<int>(Player::None) + 1].fill(1);
+}
+
+FeaturePlanes::FeaturePlanes(const Board& board) {
+    for (auto player : { Player::White, Player::None, Player::Black }) {
+        copy(board.moveStates(player).begin(), board.moveStates(player).end(), m_planes[static_cast<int>(player) + 1].begin());
+    }
+    m_planes[LastMove].fill(0);
+    m_planes[SecondLastMove].fill(0);
+    const auto& record = board.m_moveRecord;
+    for (size_t i = 0; i <= 1 && i < record.size(); ++i) {
+        m_planes[LastMove + i][*(record.rbegin() + i)] = 1;
+    }
+    m_curPlayer = record.size() % 2 == 0 ? Player::Black : Player::White;
+}
+
+void FeaturePlanes::applyMove(Position move, Player player, const vector<Position>& record) {
+    m_planes[static_cast<int>(Player::None) + 1][move] = 0;
+    m_planes[static_cast<int>(player) + 1][move] = 1;
+    if (record.size() >= 2) {
+        m_planes[SecondLastMove][*(record.rbegin() + 1)] = 0;
+    }
+    if (!record.empty()) {
+        m_planes[SecondLastMove][record.back()] = 1;
+        m_planes[LastMove][record.back()] = 0;
+    }
+    m_planes[LastMove][move] = 1;
+    m_curPlayer = -player;
+}
+
+void FeaturePlanes::revertMove(Position move, Player player, const vector<Position>& record) {
+    m_planes[static_cast<int>(player) + 1][move] = 0;
+    m_planes[static_cast<int>(Player::None) + 1][move] = 1;
+    m_planes[LastMove][move] = 0;
+    if (!record.empty()) {
+        m_planes[SecondLastMove][record.back()] = 0;
+        m_planes[LastMove][record.back()] = 1;
+    }
+    if (record.size() >= 2) {
+        m_planes[SecondLastMove][*(record.rbegin() + 1)] = 1;
+    }
+    m_curPlayer = player;
+}
+
+void FeaturePlanes::copyTo(uint8_t* states) const {
+    const int order[Planes - 1] = {
+        static_cast<int>(m_curPlayer) + 1, static_cast<int>(-m_curPlayer) + 1, static_cast<int>(Player::None) + 1, LastMove, SecondLastMove
+    };
+    for (int i = 0; i < Planes - 1; ++i) {
+        copy(m_planes[order[i]].begin(), m_planes[order[i]].end(), states + i * BOARD_SIZE);
+    }
+    fill(states + (Planes - 1) * BOARD_SIZE, states + Planes * BOARD_SIZE, m_curPlayer == Player::Black);
+}
+
+/* ------------------- SymmetricHashʵ ------------------- */
+
+SymmetricHash::SymmetricHash() {
+	// 任ֻǸû̵Ĺϣڱ任²
+	std::uint64_t hash = 0;
+	for (int i = 0; i < BOARD_SIZE; ++i) {
+		hash ^= BoardHash::HashPose(i, Player::None);
 	}
+	hashes.fill(hash);
+}
+
+SymmetricHash::SymmetricHash(const Board& board) : SymmetricHash() {
 	for (int i = 0; i < BOARD_SIZE; ++i) {
-		std::copy(begin(data[i]), end(data[i]), begin(keys[i]));
+		if (board.moveState(Player::Black, i)) {
+			toggle(i, Player::Black);
+		} else if (board.moveState(Player::White, i)) {
+			toggle(i, Player::White);
+		}
 	}
-	return keys;
-}();
\ No newline at end of file
+}
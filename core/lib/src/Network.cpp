@@ -0,0 +1,330 @@
+#include "Network.h"
+#include "SelfPlay.h"
+#include "utils/MappedFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+using namespace std;
+
+namespace Gomoku {
+
+/* ------------------- 文件格式 ------------------- */
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t width;  // 棋盘边长，与网络的输入平面及策略输出对应
+    uint32_t layers; // 三部分的层数之和
+};
+
+// 每层的表头之后依次为权重（按行存储，int8时先存outputs个缩放系数）与outputs个float偏置
+struct LayerHeader {
+    uint8_t part;       // 0为主干，1为价值头，2为策略头
+    uint8_t activation;
+    uint8_t precision;
+    uint8_t kernel;
+    uint32_t inputs;
+    uint32_t outputs;
+};
+
+constexpr char NetworkMagic[4] = { 'G', 'M', 'N', 'N' };
+constexpr uint32_t NetworkVersion = 1;
+
+static_assert(sizeof(Header) == 16 && sizeof(LayerHeader) == 12, "network layout must not depend on padding");
+static_assert(sizeof(Eigen::half) == 2, "float16 weights are stored by their bit pattern");
+
+using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+// 顺序读取映射的文件内容，越界时抛出std::runtime_error
+class Reader {
+public:
+    Reader(const MappedFile& file, const string& path) : m_file(file), m_path(path) { }
+
+    // 剩余内容不足size字节时抛出异常，在按表头分配内存前调用
+    void expect(size_t size) const {
+        if (m_file.size() - m_offset < size) {
+            throw runtime_error("network weights " + m_path + " are truncated");
+        }
+    }
+
+    void read(void* dst, size_t size) {
+        expect(size);
+        memcpy(dst, m_file.data() + m_offset, size);
+        m_offset += size;
+    }
+
+    bool done() const { return m_offset == m_file.size(); }
+
+private:
+    const MappedFile& m_file;
+    const string& m_path;
+    size_t m_offset = 0;
+};
+
+static Eigen::MatrixXf ReadWeights(Reader& reader, PolicyValueNetwork::Precision precision, size_t rows, size_t cols) {
+    using Precision = PolicyValueNetwork::Precision;
+    const size_t count = rows * cols;
+    const size_t element = precision == Precision::Float32 ? sizeof(float) : precision == Precision::Float16 ? sizeof(Eigen::half) : sizeof(int8_t);
+    reader.expect(count * element + (precision == Precision::Int8 ? rows * sizeof(float) : 0));
+    RowMajorMatrix weights(rows, cols);
+    if (precision == Precision::Float32) {
+        reader.read(weights.data(), count * sizeof(float));
+    } else if (precision == Precision::Float16) {
+        vector<Eigen::half> values(count);
+        reader.read(values.data(), count * sizeof(Eigen::half));
+        transform(values.begin(), values.end(), weights.data(), [](Eigen::half value) { return float(value); });
+    } else {
+        Eigen::VectorXf scales(rows);
+        vector<int8_t> values(count);
+        reader.read(scales.data(), rows * sizeof(float));
+        reader.read(values.data(), count);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < cols; ++j) {
+                weights(i, j) = values[i * cols + j] * scales[i];
+            }
+        }
+    }
+    return weights;
+}
+
+static void WriteWeights(ofstream& ofs, PolicyValueNetwork::Precision precision, const Eigen::MatrixXf& matrix) {
+    using Precision = PolicyValueNetwork::Precision;
+    const RowMajorMatrix weights = matrix;
+    if (precision == Precision::Float32) {
+        ofs.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(float));
+    } else if (precision == Precision::Float16) {
+        vector<Eigen::half> values(weights.data(), weights.data() + weights.size());
+        ofs.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(Eigen::half));
+    } else {
+        // 缩放系数取每行绝对值的最大值映射至127，全零的行系数为0
+        const Eigen::VectorXf scales = weights.cwiseAbs().rowwise().maxCoeff() / 127.0f;
+        vector<int8_t> values(weights.size());
+        for (Eigen::Index i = 0; i < weights.rows(); ++i) {
+            for (Eigen::Index j = 0; j < weights.cols(); ++j) {
+                values[i * weights.cols() + j] = scales[i] == 0 ? 0 : int8_t(std::round(weights(i, j) / scales[i]));
+            }
+        }
+        ofs.write(reinterpret_cast<const char*>(scales.data()), scales.size() * sizeof(float));
+        ofs.write(reinterpret_cast<const char*>(values.data()), values.size());
+    }
+}
+
+/* ------------------- 前向传播 ------------------- */
+
+// 特征平面以 (batch * BOARD_SIZE) x channels 的矩阵表示，第n个局面占第n * BOARD_SIZE行起的BOARD_SIZE行。
+// 展开后第 (c * kernel + ky) * kernel + kx 列为第c个通道平移 (ky, kx) - kernel / 2 后的平面，越界处补0
+static Eigen::MatrixXf Im2Col(const Eigen::MatrixXf& planes, int kernel, size_t batch) {
+    Eigen::MatrixXf columns = Eigen::MatrixXf::Zero(planes.rows(), planes.cols() * kernel * kernel);
+    for (int c = 0, col = 0; c < planes.cols(); ++c) {
+        for (int dy = -kernel / 2; dy <= kernel / 2; ++dy) {
+            for (int dx = -kernel / 2; dx <= kernel / 2; ++dx, ++col) {
+                const int x_begin = std::max(0, -dx), x_end = std::min<int>(WIDTH, WIDTH - dx);
+                for (size_t n = 0; n < batch; ++n) {
+                    for (int y = std::max(0, -dy); y < std::min<int>(HEIGHT, HEIGHT - dy); ++y) {
+                        const auto dst = n * BOARD_SIZE + y * WIDTH + x_begin;
+                        const auto src = n * BOARD_SIZE + (y + dy) * WIDTH + x_begin + dx;
+                        columns.col(col).segment(dst, x_end - x_begin) = planes.col(c).segment(src, x_end - x_begin);
+                    }
+                }
+            }
+        }
+    }
+    return columns;
+}
+
+// 将特征平面展平为 batch x (channels * BOARD_SIZE)，同channels_first的Flatten按通道优先排列
+static Eigen::MatrixXf Flatten(const Eigen::MatrixXf& planes, size_t batch) {
+    Eigen::MatrixXf features(batch, planes.cols() * BOARD_SIZE);
+    for (size_t n = 0; n < batch; ++n) {
+        for (int c = 0; c < planes.cols(); ++c) {
+            features.block(n, c * BOARD_SIZE, 1, BOARD_SIZE) = planes.block(n * BOARD_SIZE, c, BOARD_SIZE, 1).transpose();
+        }
+    }
+    return features;
+}
+
+static void Activate(Eigen::MatrixXf& x, PolicyValueNetwork::Activation activation) {
+    using Activation = PolicyValueNetwork::Activation;
+    switch (activation) {
+    case Activation::ReLU:
+        x = x.cwiseMax(0.0f);
+        break;
+    case Activation::Tanh:
+        x = x.array().tanh();
+        break;
+    case Activation::Softmax: { // 全连接层的输出每行为一个局面
+        const Eigen::VectorXf max = x.rowwise().maxCoeff();
+        x = (x.colwise() - max).array().exp();
+        const Eigen::VectorXf sum = x.rowwise().sum();
+        x = x.array().colwise() / sum.array();
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static Eigen::MatrixXf Forward(const vector<PolicyValueNetwork::Layer>& layers, Eigen::MatrixXf x, size_t batch) {
+    bool spatial = true;
+    for (auto& layer : layers) {
+        if (layer.kernel == 0 && spatial) {
+            x = Flatten(x, batch);
+            spatial = false;
+        }
+        if (layer.kernel > 1) {
+            x = Im2Col(x, layer.kernel, batch);
+        }
+        x = (x * layer.weights.transpose()).rowwise() + layer.bias.transpose();
+        Activate(x, layer.activation);
+    }
+    return x;
+}
+
+/* ------------------- PolicyValueNetwork类实现 ------------------- */
+
+PolicyValueNetwork::PolicyValueNetwork(const string& path) {
+    MappedFile file(path);
+    Reader reader(file, path);
+    Header header;
+    reader.read(&header, sizeof(Header));
+    if (memcmp(header.magic, NetworkMagic, sizeof(NetworkMagic)) != 0 || header.version != NetworkVersion) {
+        throw runtime_error(path + " is not a network weights file of version " + to_string(NetworkVersion));
+    }
+    if (header.width != WIDTH) {
+        throw runtime_error("network weights " + path + " were exported for a " + to_string(header.width) + "x" + to_string(header.width) + " board");
+    }
+    for (uint32_t i = 0; i < header.layers; ++i) {
+        LayerHeader layer_header;
+        reader.read(&layer_header, sizeof(LayerHeader));
+        if (layer_header.part > 2 || layer_header.activation > uint8_t(Activation::Softmax) || layer_header.precision > uint8_t(Precision::Int8)) {
+            throw runtime_error("network weights " + path + " contain an unknown layer type");
+        }
+        Layer layer{};
+        layer.kernel = layer_header.kernel;
+        layer.inputs = int(layer_header.inputs);
+        layer.outputs = int(layer_header.outputs);
+        layer.activation = Activation(layer_header.activation);
+        const size_t kernel = std::max(layer.kernel, 1);
+        layer.weights = ReadWeights(reader, Precision(layer_header.precision), layer_header.outputs, layer_header.inputs * kernel * kernel);
+        reader.expect(layer_header.outputs * sizeof(float));
+        layer.bias.resize(layer_header.outputs);
+        reader.read(layer.bias.data(), layer_header.outputs * sizeof(float));
+        (layer_header.part == 0 ? m_trunk : layer_header.part == 1 ? m_valueHead : m_policyHead).push_back(std::move(layer));
+    }
+    if (!reader.done()) {
+        throw runtime_error("network weights " + path + " have trailing data");
+    }
+    try {
+        validate();
+    } catch (const invalid_argument& e) {
+        throw runtime_error("network weights " + path + " are malformed: " + e.what());
+    }
+}
+
+void PolicyValueNetwork::save(const string& path, Precision precision) const {
+    validate();
+    ofstream ofs(path, ios::binary | ios::trunc);
+    if (!ofs.is_open()) {
+        throw runtime_error("cannot write network weights to " + path);
+    }
+    Header header = { {}, NetworkVersion, WIDTH, uint32_t(m_trunk.size() + m_valueHead.size() + m_policyHead.size()) };
+    memcpy(header.magic, NetworkMagic, sizeof(NetworkMagic));
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    uint8_t part = 0;
+    for (auto layers : { &m_trunk, &m_valueHead, &m_policyHead }) {
+        for (auto& layer : *layers) {
+            LayerHeader layer_header = {
+                part, uint8_t(layer.activation), uint8_t(precision), uint8_t(layer.kernel), uint32_t(layer.inputs), uint32_t(layer.outputs)
+            };
+            ofs.write(reinterpret_cast<const char*>(&layer_header), sizeof(LayerHeader));
+            WriteWeights(ofs, precision, layer.weights);
+            ofs.write(reinterpret_cast<const char*>(layer.bias.data()), layer.bias.size() * sizeof(float));
+        }
+        ++part;
+    }
+    if (!ofs) {
+        throw runtime_error("cannot write network weights to " + path);
+    }
+}
+
+void PolicyValueNetwork::validate() const {
+    auto check = [](const vector<Layer>& layers, const char* name, int channels, bool spatial, int features) {
+        if (layers.empty()) {
+            throw invalid_argument(string(name) + " has no layers");
+        }
+        for (size_t i = 0; i < layers.size(); ++i) {
+            auto& layer = layers[i];
+            auto fail = [&](const char* reason) {
+                throw invalid_argument(string(name) + " layer " + to_string(i) + " " + reason);
+            };
+            if (layer.kernel > 0 && (!spatial || layer.kernel % 2 == 0 || layer.kernel > UINT8_MAX)) {
+                fail("must be an odd-sized convolution following feature planes");
+            }
+            if (layer.kernel > 0 && layer.activation == Activation::Softmax) {
+                fail("cannot apply softmax to feature planes");
+            }
+            if (layer.inputs != (layer.kernel == 0 && spatial ? channels * BOARD_SIZE : channels)) {
+                fail("does not match the size of its input");
+            }
+            const int kernel = std::max(layer.kernel, 1);
+            if (layer.outputs <= 0 || layer.weights.rows() != layer.outputs ||
+                layer.weights.cols() != layer.inputs * kernel * kernel || layer.bias.size() != layer.outputs) {
+                fail("has weights of a wrong shape");
+            }
+            channels = layer.outputs;
+            spatial = layer.kernel > 0;
+        }
+        if (features > 0 && (spatial || channels != features)) {
+            throw invalid_argument(string(name) + " must end with a dense layer of " + to_string(features) + " outputs");
+        }
+        return channels;
+    };
+    const int channels = check(m_trunk, "trunk", Sample::Planes, true, 0);
+    if (m_trunk.back().kernel == 0) {
+        throw invalid_argument("trunk must end with feature planes");
+    }
+    check(m_valueHead, "value head", channels, true, 1);
+    check(m_policyHead, "policy head", channels, true, BOARD_SIZE);
+}
+
+Policy::EvalResult PolicyValueNetwork::evaluate(const Board& board) const {
+    return evaluate(vector<Board>{ board }).front();
+}
+
+vector<Policy::EvalResult> PolicyValueNetwork::evaluate(const vector<Board>& boards) const {
+    vector<uint8_t> states(boards.size() * Sample::Planes * BOARD_SIZE);
+    for (size_t n = 0; n < boards.size(); ++n) {
+        Sample::EncodeStates(boards[n], states.data() + n * Sample::Planes * BOARD_SIZE);
+    }
+    return evaluate(states.data(), boards.size());
+}
+
+vector<Policy::EvalResult> PolicyValueNetwork::evaluate(const uint8_t* states, size_t batch) const {
+    if (batch == 0) {
+        return {};
+    }
+    // 每个局面的各平面依次存储，恰为 BOARD_SIZE x Planes 的列主序矩阵
+    using Planes = Eigen::Matrix<uint8_t, BOARD_SIZE, Sample::Planes>;
+    Eigen::MatrixXf input(batch * BOARD_SIZE, Sample::Planes);
+    for (size_t n = 0; n < batch; ++n) {
+        input.middleRows(n * BOARD_SIZE, BOARD_SIZE) = Eigen::Map<const Planes>(states + n * Sample::Planes * BOARD_SIZE).cast<float>();
+    }
+    return forward(input, batch);
+}
+
+vector<Policy::EvalResult> PolicyValueNetwork::forward(const Eigen::MatrixXf& input, size_t batch) const {
+    const auto shared = Forward(m_trunk, input, batch);
+    const auto values = Forward(m_valueHead, shared, batch);
+    const auto probs = Forward(m_policyHead, shared, batch);
+    vector<Policy::EvalResult> results;
+    results.reserve(batch);
+    for (size_t n = 0; n < batch; ++n) {
+        results.emplace_back(values(n, 0), probs.row(n).transpose());
+    }
+    return results;
+}
+
+}
@@ -0,0 +1,122 @@
+#include "OpeningBook.h"
+#include "utils/MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
+
+using namespace std;
+
+namespace Gomoku {
+
+/* ------------------- OpeningBook类实现 ------------------- */
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint64_t fingerprint; // 空棋盘的哈希，标识生成时所用的Zobrist键
+    uint64_t count;
+};
+
+constexpr char BookMagic[4] = { 'G', 'M', 'B', 'K' };
+constexpr uint32_t BookVersion = 1;
+
+static_assert(sizeof(Header) == 24 && sizeof(OpeningBook::Entry) == 16, "opening book layout must not depend on padding");
+
+inline uint64_t fingerprint() {
+    return SymmetricHash().hashes[0];
+}
+
+OpeningBook::OpeningBook() = default;
+
+OpeningBook::OpeningBook(const string& path) : m_file(make_unique<MappedFile>(path)) {
+    Header header;
+    if (m_file->size() < sizeof(Header)) {
+        throw runtime_error("opening book " + path + " is truncated");
+    }
+    memcpy(&header, m_file->data(), sizeof(Header));
+    if (memcmp(header.magic, BookMagic, sizeof(BookMagic)) != 0 || header.version != BookVersion) {
+        throw runtime_error(path + " is not an opening book of version " + to_string(BookVersion));
+    }
+    if (header.fingerprint != fingerprint()) {
+        throw runtime_error("opening book " + path + " was generated with different zobrist keys");
+    }
+    if (m_file->size() != sizeof(Header) + header.count * sizeof(Entry)) {
+        throw runtime_error("opening book " + path + " is truncated");
+    }
+    m_entries = reinterpret_cast<const Entry*>(m_file->data() + sizeof(Header));
+    m_size = size_t(header.count);
+}
+
+OpeningBook::~OpeningBook() = default;
+
+Position OpeningBook::lookup(const Board& board) const {
+    if (m_size == 0 || board.m_curPlayer == Player::None) {
+        return Position::npos;
+    }
+    const SymmetricHash hash(board);
+    const auto symmetry = hash.symmetry();
+    const auto key = hash.hashes[symmetry];
+    // 同一局面的表项相邻，且按访问次数降序排列
+    auto entry = lower_bound(m_entries, m_entries + m_size, key, [](const Entry& entry, uint64_t key) { return entry.key < key; });
+    if (entry == m_entries + m_size || entry->key != key) {
+        return Position::npos;
+    }
+    Position move = BoardHash::Transform(int(entry->move), BoardHash::Inverse(symmetry));
+    return board.checkMove(move) ? move : Position::npos; // 哈希碰撞时着法可能已被占据
+}
+
+vector<OpeningBook::Entry> OpeningBook::Generate(shared_ptr<Policy> policy, size_t iterations, int plies, size_t width) {
+    vector<Entry> entries;
+    unordered_set<uint64_t> visited;
+    Board board;
+    function<void()> expand = [&]() {
+        if (int(board.m_moveRecord.size()) >= plies || board.m_curPlayer == Player::None) {
+            return;
+        }
+        const SymmetricHash hash(board);
+        const auto symmetry = hash.symmetry();
+        const auto key = hash.hashes[symmetry];
+        if (!visited.insert(key).second) {
+            return; // 对称的局面已由其他着法顺序收录
+        }
+        const auto last_move = board.m_moveRecord.empty() ? Position(-1) : board.m_moveRecord.back();
+        MCTS mcts(iterations, last_move, -board.m_curPlayer, policy);
+        const auto visits = mcts.rootVisits(board);
+        vector<int> moves(BOARD_SIZE);
+        iota(moves.begin(), moves.end(), 0);
+        const auto kept = std::min(width, moves.size());
+        partial_sort(moves.begin(), moves.begin() + kept, moves.end(), [&](int lhs, int rhs) { return visits[lhs] > visits[rhs]; });
+        for (size_t i = 0; i < kept && visits[moves[i]] > 0; ++i) {
+            const auto move = BoardHash::Transform(moves[i], symmetry);
+            entries.push_back({ key, uint16_t(move.id), 0, uint32_t(visits[moves[i]]) });
+            board.applyMove(moves[i]);
+            expand();
+            board.revertMove();
+        }
+    };
+    expand();
+    return entries;
+}
+
+void OpeningBook::Write(const string& path, vector<Entry> entries) {
+    sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.key != rhs.key ? lhs.key < rhs.key : lhs.visits > rhs.visits;
+    });
+    ofstream ofs(path, ios::binary | ios::trunc);
+    if (!ofs.is_open()) {
+        throw runtime_error("cannot write opening book to " + path);
+    }
+    Header header = { {}, BookVersion, fingerprint(), entries.size() };
+    memcpy(header.magic, BookMagic, sizeof(BookMagic));
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    ofs.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry));
+    if (!ofs) {
+        throw runtime_error("cannot write opening book to " + path);
+    }
+}
+
+}
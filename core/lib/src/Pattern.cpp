@@ -1,20 +1,22 @@
 #include "Pattern.h"
 #include "utils/ACAutomata.h"
+#include "PatternTables.h"
+#include <algorithm>
 #include <iostream>
 #include <bitset>
 #include <future>
+#include <stdexcept>
 
 using namespace std;
 using namespace Eigen;
 
 namespace Gomoku {
 
-/* ------------------- Pattern类实现 ------------------- */
-
-Pattern::Pattern(std::string_view proto, Type type, int score) 
-    : str(proto.begin() + 1, proto.end()), score(score), type(type),
-      favour(proto[0] == '+' ? Player::Black : Player::White) {
-
+// 检查模式下分数不应为负
+inline void checkScore(int score) {
+    if (Evaluator::Checked && score < 0) {
+        throw logic_error("evaluator score becomes negative");
+    }
 }
 
 /* ------------------- PatternSearch类实现 ------------------- */
@@ -61,11 +63,11 @@ PatternSearch::Entry PatternSearch::generator::operator*() const {
     return { ref->m_patterns[-ref->m_base[leaf]], offset };
 }
 
-PatternSearch::generator PatternSearch::execute(string_view target) {
+PatternSearch::generator PatternSearch::execute(string_view target) const {
     return generator{ target, this };
 }
 
-vector<PatternSearch::Entry> PatternSearch::matches(string_view target) {
+vector<PatternSearch::Entry> PatternSearch::matches(string_view target) const {
     vector<Entry> entries;
     for (auto record : execute(target)) { 
         entries.push_back(record); 
@@ -73,24 +75,26 @@ vector<PatternSearch::Entry> PatternSearch::matches(string_view target) {
     return entries;
 }
 
-/* ------------------- Evaluator::Updater类实现 ------------------- */
-
-template <size_t Length = TARGET_LEN, typename Array_t>
-inline auto& LineView(Array_t& src, Position move, Direction dir) {
-    static vector<typename Array_t::value_type*> view_ptrs(Length);
-    auto [dx, dy] = *dir;
-    for (int i = 0, j = i - Length / 2; i < Length; ++i, ++j) {
-        auto x = move.x() + dx * j, y = move.y() + dy * j;
-        if ((x >= 0 && x < WIDTH) && (y >= 0 && y < HEIGHT)) {
-            view_ptrs[i] = &src[Position{ x, y }];
+void PatternSearch::lookup(string_view target, Entries& entries) const {
+    constexpr int center = TARGET_LEN / 2, mask = (1 << WindowBits) - 1;
+    unsigned window = 0;
+    for (int offset = 0; offset < TARGET_LEN; ++offset) {
+        window = ((window << 2) | (target[offset] - 1)) & mask; // 滚动窗口，编码1~4各减1压入2比特
+        if (offset < center) {
+            continue; // 结尾在中心点之前的模式不可能覆盖中心点
         }
-        else {
-            view_ptrs[i] = nullptr;
+        for (int i = m_windowFirst[window]; i < m_windowFirst[window + 1]; ++i) {
+            const auto& pattern = m_patterns[m_windowPatterns[i]];
+            if (pattern.str.length() <= size_t(offset - center)) {
+                break; // 模式按长度降序排列，其余模式更短，都覆盖不到中心点
+            }
+            entries.emplace_back(pattern, offset);
         }
     }
-    return view_ptrs;
 }
 
+/* ------------------- Evaluator::Updater类实现 ------------------- */
+
 template <int Size = BLOCK_SIZE, typename Array_t, typename value_t = typename Array_t::value_type>
 inline auto BlockView(Array_t& src, Position move) {
     auto left_bound  = std::max(move.x() - Size / 2, 0);
@@ -98,7 +102,7 @@ inline auto BlockView(Array_t& src, Position move) {
     auto up_bound    = std::max(move.y() - Size / 2, 0);
     auto down_bound  = std::min(move.y() + Size / 2, HEIGHT - 1);
     Position lu{ left_bound, up_bound }, rd{ right_bound, down_bound };
-    if constexpr (std::is_same_v<Array_t, Array<value_t, Size, Size, RowMajor>>) { // 权重矩阵落在这里
+    if constexpr (Array_t::RowsAtCompileTime == Size && Array_t::ColsAtCompileTime == Size) { // 权重矩阵落在这里
         Position coord_transform = move - Position{ Size / 2, Size / 2 };
         lu = lu - coord_transform, rd = rd - coord_transform;
         return src.block(lu.y(), lu.x(), rd.y() - lu.y() + 1, rd.x() - lu.x() + 1);
@@ -112,27 +116,20 @@ void Evaluator::Updater::reset(int delta, Position move, Player player) {
 	this->delta = delta;
     this->move = move;
 	this->player = player;
-    this->compound_keys.clear();
+    for (auto& compound : compounds) { // 只清除用到的索引，而非整张表
+        compound_index[CompoundKey(compound.position, compound.favour)] = 0;
+    }
     this->compounds.clear();
 }
 
 Compound* Evaluator::Updater::findCompound(Position pose, Player player) {
-    for (int i = 0; i < compound_keys.size(); ++i) {
-        if (compound_keys[i] == make_tuple(pose, player)) {
-            return &compounds[i];
-        }
-    }
-    return nullptr;
+    const auto index = compound_index[CompoundKey(pose, player)];
+    return index == 0 ? nullptr : &compounds[index - 1];
 }
 
 void Evaluator::Updater::matchPatterns(Direction dir) {
     matchResults(delta, dir).clear();
-    auto target = ev.m_boardMap.lineView(move, dir);
-    for (auto&& entry : Patterns.execute(target)) {
-        if (PatternSearch::HasCovered(entry, TARGET_LEN / 2)) {
-            matchResults(delta, dir).push_back(std::move(entry));
-        }
-    }
+    Patterns.lookup(ev.m_boardMap.lineView(move, dir), matchResults(delta, dir));
 }
 
 void Evaluator::Updater::updatePatterns(Direction dir) {
@@ -153,7 +150,8 @@ void Evaluator::Updater::updatePatterns(Direction dir) {
                 const auto update_pose = [&](Player perspective) {
                     ev.m_patternDist[current][pattern.type].set(delta, pattern.favour, perspective, dir);
                     ev.scores(pattern.favour, perspective)[current] += score;
-                    assert(ev.scores(pattern.favour, perspective)[current] >= 0);
+                    checkScore(ev.scores(pattern.favour, perspective)[current]);
+                    ev.m_index.patternDirty[pattern.type].set(current);
                 };
                 switch (piece) { // 利用了switch的穿透特性
                     case '_': update_pose(pattern.favour);
@@ -186,9 +184,9 @@ void Evaluator::Updater::updateCompound(Direction dir) {
 				continue; // 若找到复合模式记录，则代表已更新过，直接跳过
 			} 
 			if (Compound::Test(ev, current, player)) {
-				compound_keys.emplace_back(current, player);
-				compounds.emplace_back(ev, current, player);
-				compounds.back().update(delta);
+				auto& compound = compounds.emplace_back(ev, current, player);
+				compound_index[CompoundKey(current, player)] = compounds.size();
+				compound.update(delta);
 			}
 			if (view[i] == EncodeCharset('?')) {
 				break;
@@ -224,9 +222,9 @@ void Evaluator::Updater::updateCompound(Direction dir) {
 				continue; // 若找到复合模式记录，则代表已更新过，直接跳过
 			}
 			if (Compound::Test(ev, current, pattern.favour)) {
-				compound_keys.emplace_back(current, pattern.favour);
-				compounds.emplace_back(ev, current, pattern.favour);
-				compounds.back().update(delta);
+				auto& compound = compounds.emplace_back(ev, current, pattern.favour);
+				compound_index[CompoundKey(current, pattern.favour)] = compounds.size();
+				compound.update(delta);
 			}
         }
     }
@@ -237,7 +235,8 @@ void Evaluator::Updater::updateBlock(int delta, Player src_player) {
     // 数据准备
     const auto sign = [](int x) { return x < 0 ? -1 : 1; };
     const auto mask = [](int x) { return x > 0 ? 1 : 0; };
-    auto [weights, score] = BlockWeights;
+    const Eigen::Map<const Array<int, BLOCK_SIZE, BLOCK_SIZE, RowMajor>> weights(&BlockWeights[0][0]);
+    const auto score = BlockScore;
     auto base_weights  = BlockView(weights, move);
     auto count_block   = BlockView(ev.density(src_player)[0], move);
     auto weight_block  = BlockView(ev.density(src_player)[1], move);
@@ -310,26 +309,10 @@ Evaluator::Evaluator(Board * board) : m_updater(*this), m_boardMap(board) {
 Player Evaluator::applyMove(Position move) {
     if (board().m_curPlayer != Player::None && board().checkMove(move)) {
         m_updater.updateMove(move, board().m_curPlayer);
+        ++m_applies;
     }
-    for (int i = 0; i < BOARD_SIZE; ++i) {
-        if (!board().moveState(Player::None, i)) {
-            for (int j = 0; j < 4; ++j) {
-                if (m_scores[j][i] != 0) {
-                    auto b = board().toString();
-					for (auto pose : board().m_moveRecord) {
-						std::cout << std::to_string(pose) << std::endl;
-					}
-                    throw b;
-                }
-            }
-        } else {
-            for (int j = 0; j < 4; ++j) {
-                if (m_scores[j][i] < 0) {
-                    auto b = board().toString();
-                    throw b;
-                }
-            }
-        }
+    if (Checked) {
+        checkInvariants();
     }
     return board().m_curPlayer;
 }
@@ -337,6 +320,7 @@ Player Evaluator::applyMove(Position move) {
 Player Evaluator::revertMove(size_t count) {
     for (auto i = 0; i < count && !board().m_moveRecord.empty(); ++i) {
         m_updater.updateMove(board().m_moveRecord.back(), Player::None);
+        ++m_reverts;
     }
     return board().m_curPlayer;
 }
@@ -368,14 +352,101 @@ void Evaluator::syncWithBoard(const Board& board) {
     revertMove(this->board().m_moveRecord.size() - i); // 回退掉多余手
 }
 
+void Evaluator::syncWithBoard(const Board& board, const Snapshot& base) {
+    const auto& current = this->board().m_moveRecord;
+    const auto& target = board.m_moveRecord;
+    const auto& based = base.board.m_moveRecord;
+    if (based.size() <= target.size() && std::equal(based.begin(), based.end(), target.begin())) {
+        const auto common = std::mismatch(current.begin(), current.end(), target.begin(), target.end()).first - current.begin();
+        const auto replay_cost = (current.size() - common) + (target.size() - common); // 逐手悔棋再重放的手数
+        if (replay_cost > target.size() - based.size()) {
+            restore(base);
+        }
+    }
+    syncWithBoard(board);
+}
+
+void Evaluator::save(Snapshot& snapshot) const {
+    snapshot.board = *m_boardMap.m_board;
+    snapshot.lineMap = m_boardMap.m_lineMap;
+    snapshot.hash = m_boardMap.m_hash;
+    snapshot.symmetry = m_boardMap.m_symmetry;
+    snapshot.features = m_boardMap.m_features;
+    snapshot.patternDist = m_patternDist;
+    snapshot.compoundDist = m_compoundDist;
+    for (int i = 0; i < 2; ++i) {
+        std::copy(std::begin(m_density[i]), std::end(m_density[i]), std::begin(snapshot.density[i]));
+    }
+    std::copy(std::begin(m_scores), std::end(m_scores), std::begin(snapshot.scores));
+    snapshot.index = m_index;
+}
+
+void Evaluator::restore(const Snapshot& snapshot) {
+    *m_boardMap.m_board = snapshot.board;
+    m_boardMap.m_lineMap = snapshot.lineMap;
+    m_boardMap.m_hash = snapshot.hash;
+    m_boardMap.m_symmetry = snapshot.symmetry;
+    m_boardMap.m_features = snapshot.features;
+    m_patternDist = snapshot.patternDist;
+    m_compoundDist = snapshot.compoundDist;
+    for (int i = 0; i < 2; ++i) {
+        std::copy(std::begin(snapshot.density[i]), std::end(snapshot.density[i]), std::begin(m_density[i]));
+    }
+    std::copy(std::begin(snapshot.scores), std::end(snapshot.scores), std::begin(m_scores));
+    m_index = snapshot.index;
+}
+
+void Evaluator::checkInvariants() {
+    for (int type = 0; type < Pattern::Size - 1; ++type) {
+        positions(Pattern::Type(type));
+    }
+    for (int type = 0; type < Compound::Size; ++type) {
+        positions(Compound::Type(type));
+    }
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        const bool occupied = !board().moveState(Player::None, i);
+        for (int j = 0; j < 4; ++j) {
+            if (occupied ? m_scores[j][i] != 0 : m_scores[j][i] < 0) {
+                throw logic_error("evaluator scores inconsistent at " + std::to_string(Position(i)) + ":\n" + board().toString());
+            }
+        }
+        bool indexed = true;
+        for (int type = 0; type < Pattern::Size - 1; ++type) {
+            indexed &= m_index.patterns[type].contains(i) == (m_patternDist[i][type].field != 0);
+        }
+        for (int type = 0; type < Compound::Size; ++type) {
+            indexed &= m_index.compounds[type].contains(i) == (m_compoundDist[i][type].field != 0);
+        }
+        if (!indexed) {
+            throw logic_error("evaluator index inconsistent at " + std::to_string(Position(i)) + ":\n" + board().toString());
+        }
+    }
+}
+
+const PositionSet& Evaluator::positions(Pattern::Type type) {
+    auto& positions = m_index.patterns[type];
+    auto& dirty = m_index.patternDirty[type];
+    dirty.forEach([&](Position pose) { positions.assign(pose, m_patternDist[pose][type].field != 0); });
+    dirty = Bitboard();
+    return positions;
+}
+
+const PositionSet& Evaluator::positions(Compound::Type type) {
+    auto& positions = m_index.compounds[type];
+    auto& dirty = m_index.compoundDirty[type];
+    dirty.forEach([&](Position pose) { positions.assign(pose, m_compoundDist[pose][type].field != 0); });
+    dirty = Bitboard();
+    return positions;
+}
+
 void Evaluator::reset() {
     m_boardMap.reset();
     for (auto& scores : m_scores) {
-        scores.resize(BOARD_SIZE), scores.setZero();
+        scores.setZero();
     }
     for (auto& density : m_density) 
     for (auto& cnt_n_wt : density) { // count & weight
-        cnt_n_wt.resize(BOARD_SIZE), cnt_n_wt.setZero();
+        cnt_n_wt.setZero();
     }
     for (auto& distribution : m_patternDist) {
         distribution.fill(Record{}); // 最后一个元素用于总计数
@@ -383,6 +454,7 @@ void Evaluator::reset() {
     for (auto& distribution : m_compoundDist) {
         distribution.fill(Record{}); // 最后一个元素用于总计数
     }
+    m_index = Index{};
 }
 
 /* ------------------- Evaluator::Record类实现 ------------------- */
@@ -458,7 +530,9 @@ void Compound::locate() {
                 case Pattern::LiveTwo:
                     cond = L2;  break;
                 }
-                components.insert(components.end(), count, { comp_dir, comp_type });
+                for (int i = 0; i < count; ++i) {
+                    components.emplace_back(comp_dir, comp_type);
+                }
                 break; // 找到第一个符合条件的Pattern就退出。因此Pattern有优先级之分。
             }
         }
@@ -546,12 +620,13 @@ void Compound::updatePose(int delta, Position pose, Component component, Player
     const auto comp_dir = std::get<0>(component);
     ev.m_compoundDist[pose][type].set(delta, favour, perspective, comp_dir);
     ev.scores(favour, perspective)[pose] += delta * Compound::BaseScore;
-    assert(ev.scores(favour, perspective)[pose] >= 0);
+    checkScore(ev.scores(favour, perspective)[pose]);
+    ev.m_index.compoundDirty[type].set(pose);
 }
 
 /* ------------------- 数据区 ------------------- */
 
-PatternSearch Evaluator::Patterns = {
+const initializer_list<Pattern> Evaluator::Prototypes = {
     { "+xxxxx",    Pattern::Five,      9999 },
     { "-_oooo_",   Pattern::LiveFour,  9000 },
     { "-xoooo_",   Pattern::DeadFour,  2500 },
@@ -595,18 +670,10 @@ PatternSearch Evaluator::Patterns = {
     { "-x__o__x",  Pattern::DeadOne,   50 },
 };
 
-tuple<Array<int, BLOCK_SIZE, BLOCK_SIZE, RowMajor>, int> Evaluator::BlockWeights = []() {
-    tuple_element_t<0, decltype(BlockWeights)> weight;
-    tuple_element_t<1, decltype(BlockWeights)> score = 160;
-    weight << 2, 0, 0, 1, 0, 0, 2,
-              0, 4, 3, 3, 3, 4, 0,
-              0, 3, 5, 4, 5, 3, 0,
-              1, 3, 4, 0, 4, 3, 1,
-              0, 3, 5, 4, 5, 3, 0,
-              0, 4, 3, 3, 3, 4, 0,
-              2, 0, 0, 1, 0, 0, 2;
-    return make_tuple(weight, score);
-}();
+const PatternSearch Evaluator::Patterns = {
+    PatternTables::Base, PatternTables::Check, PatternTables::Fail, PatternTables::Invariants,
+    PatternTables::Patterns, PatternTables::WindowFirst, PatternTables::WindowPatterns
+};
 
 const int Compound::BaseScore = 600;
 
@@ -0,0 +1,1586 @@
+// 由AhoCorasickBuilder::Emit根据Evaluator::Prototypes生成，请勿手动修改。
+// 修改模式原型或构建过程后，运行PatternSearchTest.GeneratedTables，以其输出的文件替换本文件。
+#ifndef GOMOKU_PATTERN_TABLES_H_
+#define GOMOKU_PATTERN_TABLES_H_
+#include "Pattern.h"
+
+namespace Gomoku::PatternTables {
+
+constexpr int Base[] = {
+    0, 4, 168, 332, 599, 6, 25, 8, 84, 10, 15, 13, 13, 0, 15, -1,
+    16, 18, -2, 19, 20, 24, 25, 26, -3, -4, -5, 26, 29, 58, 40, 28,
+    34, 31, -6, 35, 37, -7, 40, 41, -8, -9, 39, 44, 49, 46, -10, 49,
+    50, -11, -12, 51, 56, 59, 57, 58, -13, -14, -15, -16, 59, 60, 71, 67,
+    64, 66, -17, 69, 70, -18, -19, 72, -20, 72, 77, 79, 82, -21, 79, -22,
+    81, -23, -24, 84, -25, 86, 92, 88, 136, 91, 91, -26, 93, -27, 93, 94,
+    115, 103, 98, 100, -28, 103, 104, -29, -30, 105, 110, 112, 111, 112, -31, -32,
+    -33, 114, -34, 116, -35, 116, 120, 129, 126, 122, -36, 125, 126, -37, -38, 128,
+    -39, 131, 132, -40, -41, 133, 135, -42, 137, -43, 137, 140, 158, 148, 142, 146,
+    147, 147, -44, -45, 149, -46, 151, -47, 152, 154, -48, 157, 158, -49, -50, 161,
+    158, -51, 162, 164, -52, 167, 168, -53, -54, 170, 228, 172, 248, 174, 204, 173,
+    186, 179, 176, -55, 179, 184, 185, 186, -56, -57, -58, 184, 189, -59, 195, 189,
+    194, 195, -60, -61, 198, -62, -63, 204, 197, 198, 203, -64, -65, 205, 203, 208,
+    217, 212, 213, 214, 215, -66, -67, -68, 217, -69, 218, 223, -71, 224, 227, -70,
+    -72, 220, 224, -73, 229, -74, 229, 232, 236, 234, 235, -75, 237, -76, 237, 241,
+    240, -77, 242, 246, 247, 248, -78, -79, -80, 250, 294, 252, 301, 251, 274, 255,
+    262, 260, 261, 262, -81, -82, -83, 265, -84, -85, 269, 264, 265, 270, -86, 273,
+    274, -87, -88, 275, 278, -89, 287, 283, 277, 283, 284, -90, -91, 288, 289, 290,
+    -92, -93, -94, 290, 294, 295, -95, -96, 295, 299, 298, -97, 301, -98, 302, 303,
+    306, 322, 312, 310, 310, 311, -99, -100, 314, 315, -101, -102, 315, 320, 321, 322,
+    -103, -104, -105, 321, 332, 324, 329, 330, 331, -106, -107, -108, -109, 334, 392, 336,
+    451, 338, 368, 337, 350, 343, 340, -110, 343, 348, 349, 350, -111, -112, -113, 348,
+    353, -114, 359, 353, 358, 359, -115, -116, 362, -117, -118, 368, 361, 362, 367, -119,
+    -120, 369, 367, 372, 381, 376, 377, 378, 379, -121, -122, -123, 381, -124, 382, 387,
+    -126, 388, 391, -125, -127, 384, 388, -128, 393, -129, 393, 396, 425, 407, 395, 401,
+    398, -130, 402, 404, -131, 407, 408, -132, -133, 406, 411, 416, 413, -134, 416, 417,
+    -135, -136, 418, 423, 426, 424, 425, -137, -138, -139, -140, 426, 427, 438, 434, 431,
+    433, -141, 436, 437, -142, -143, 439, -144, 439, 444, 446, 449, -145, 446, -146, 448,
+    -147, -148, 451, -149, 453, 497, 455, 542, 454, 477, 458, 465, 463, 464, 465, -150,
+    -151, -152, 468, -153, -154, 472, 467, 468, 473, -155, 476, 477, -156, -157, 478, 481,
+    -158, 490, 486, 480, 486, 487, -159, -160, 491, 492, 493, -161, -162, -163, 493, 497,
+    498, -164, -165, 498, 499, 520, 508, 503, 505, -166, 508, 509, -167, -168, 510, 515,
+    517, 516, 517, -169, -170, -171, 519, -172, 521, -173, 521, 525, 534, 531, 527, -174,
+    530, 531, -175, -176, 533, -177, 536, 537, -178, -179, 538, 540, -180, 542, -181, 544,
+    563, 546, 583, 549, 554, -182, 552, 549, 553, -183, 556, 557, -184, -185, 557, 562,
+    563, 564, -186, -187, -188, 564, 568, 573, 572, 570, -189, 572, -190, 574, -191, 576,
+    -192, 577, 579, -193, 582, 583, -194, -195, 582, 589, 585, 590, 591, 592, -196, -197,
+    -198, 593, 595, -199, 598, 599, -200, -201, 601, 655, 603, 710, 605, 628, 606, 613,
+    611, 612, 613, -202, -203, -204, 611, 616, -205, 623, 621, 622, 623, -206, -207, -208,
+    621, 626, -209, 628, -210, 629, 627, 633, 639, -211, -212, 634, 638, 639, -213, -214,
+    643, -215, -216, 651, 646, 652, 653, 654, 641, 642, 651, -217, -218, -219, -220, 656,
+    -221, 656, 659, 681, 666, 661, 663, -222, 666, 667, -223, -224, 665, 671, 676, -225,
+    673, -226, 676, 677, -227, -228, 675, 681, 682, -229, -230, 682, 682, 692, 687, -231,
+    689, -232, 692, 693, -233, -234, 696, -235, 705, 695, 700, 707, 708, 702, -236, 705,
+    706, -237, -238, -239, -240, 710, -241, 712, 755, 714, 799, 713, 731, 717, 724, 722,
+    723, 724, -242, -243, -244, 724, 729, 730, 731, -245, -246, -247, 735, -248, -249, 748,
+    738, 744, 745, 744, 733, 734, 743, -250, -251, -252, 749, 750, 751, -253, -254, -255,
+    751, 755, 756, -256, -257, 756, 757, 773, 766, 761, 763, -258, 766, 767, -259, -260,
+    768, 770, -261, 773, 774, -262, -263, 777, -264, 791, 776, 781, 788, 788, 783, -265,
+    786, 787, -266, -267, -268, 790, -269, 793, 794, -270, -271, 795, 797, -272, 799, -273,
+    801, 819, 805, 838, -274, 812, 808, 813, 814, 815, 804, 812, -275, -276, -277, -278,
+    815, 819, 820, -279, -280, 823, -281, 830, 822, 827, 832, 833, 829, -282, 831, -283,
+    -284, -285, 834, 836, -286, 838, -287, 839, 846, 844, 845, 846, -288, -289, -290, 848,
+    -291, 851, 852, -292, -293, 0, -853, -854, -855, -856, -857, -858, -859, -860, -861, -862,
+    -863, -864, -865, -866, -867, -868, -869, -870, -871, -872, -873, -874, -875, -876, -877, -878,
+    -879, -880, -881, -882, -883, -884, -885, -886, -887, -888, -889, -890, -891, -892, -893, -894,
+    -895, -896, -897, -898, -899, -900, -901, -902, -903, -904, -905, -906, -907, -908, -909, -910,
+    -911, -912, -913, -914, -915, -916, -917, -918, -919, -920, -921, -922, -923, -924, -925, -926,
+    -927, -928, -929, -930, -931, -932, -933, -934, -935, -936, -937, -938, -939, -940, -941, -942,
+    -943, -944, -945, -946, -947, -948, -949, -950, -951, -952, -953, -954, -955, -956, -957, -958,
+    -959, -960, -961, -962, -963, -964, -965, -966, -967, -968, -969, -970, -971, -972, -973, -974,
+    -975, -976, -977, -978, -979, -980, -981, -982, -983, -984, -985, -986, -987, -988, -989, -990,
+    -991, -992, -993, -994, -995, -996, -997, -998, -999, -1000, -1001, -1002, -1003, -1004, -1005, -1006,
+    -1007, -1008, -1009, -1010, -1011, -1012, -1013, -1014, -1015, -1016, -1017, -1018, -1019, -1020, -1021, -1022,
+};
+
+constexpr int Check[] = {
+    -853, 0, 0, 0, 0, 1, 1, 5, 1, 7, 5, 9, 7, 11, 12, 14,
+    10, 16, 17, 10, 19, 20, 20, 20, 21, 22, 23, 6, 27, 6, 27, 28,
+    31, 28, 32, 33, 35, 36, 35, 35, 38, 39, 30, 42, 30, 43, 45, 43,
+    43, 47, 48, 44, 51, 44, 51, 51, 52, 54, 55, 53, 29, 60, 29, 60,
+    61, 64, 65, 64, 64, 67, 68, 63, 71, 62, 73, 62, 73, 74, 74, 78,
+    74, 80, 76, 75, 83, 8, 8, 85, 8, 87, 85, 89, 90, 92, 86, 94,
+    86, 94, 95, 98, 99, 98, 98, 101, 102, 97, 105, 97, 105, 105, 106, 108,
+    109, 107, 113, 107, 115, 96, 117, 96, 117, 118, 121, 118, 118, 123, 124, 120,
+    127, 120, 120, 129, 130, 119, 133, 134, 133, 136, 88, 138, 88, 138, 139, 142,
+    139, 142, 143, 145, 144, 148, 144, 150, 141, 152, 153, 152, 152, 155, 156, 140,
+    140, 159, 160, 162, 163, 162, 162, 165, 166, 2, 2, 169, 2, 171, 169, 173,
+    171, 175, 173, 177, 178, 180, 180, 180, 181, 182, 183, 176, 187, 191, 176, 188,
+    188, 188, 192, 193, 190, 200, 201, 190, 196, 196, 196, 202, 199, 174, 205, 206,
+    174, 205, 207, 207, 207, 210, 211, 212, 209, 216, 208, 218, 225, 208, 218, 219,
+    226, 219, 219, 222, 221, 228, 170, 230, 170, 230, 231, 234, 233, 236, 232, 238,
+    232, 239, 240, 242, 242, 242, 243, 244, 245, 172, 172, 249, 172, 251, 249, 253,
+    251, 255, 255, 255, 257, 258, 259, 256, 267, 268, 256, 263, 263, 263, 269, 266,
+    266, 271, 272, 254, 275, 280, 254, 275, 276, 276, 276, 281, 282, 279, 279, 279,
+    285, 286, 287, 278, 291, 291, 292, 293, 250, 296, 250, 297, 298, 300, 252, 302,
+    303, 252, 302, 303, 304, 304, 308, 309, 307, 307, 312, 313, 306, 316, 316, 316,
+    317, 318, 319, 305, 305, 323, 325, 325, 325, 326, 327, 328, 324, 3, 3, 333,
+    3, 335, 333, 337, 335, 339, 337, 341, 342, 344, 344, 344, 345, 346, 347, 340,
+    351, 355, 340, 352, 352, 352, 356, 357, 354, 364, 365, 354, 360, 360, 360, 366,
+    363, 338, 369, 370, 338, 369, 371, 371, 371, 374, 375, 376, 373, 380, 372, 382,
+    389, 372, 382, 383, 390, 383, 383, 386, 385, 392, 334, 394, 334, 394, 395, 398,
+    395, 399, 400, 402, 403, 402, 402, 405, 406, 397, 409, 397, 410, 412, 410, 410,
+    414, 415, 411, 418, 411, 418, 418, 419, 421, 422, 420, 396, 427, 396, 427, 428,
+    431, 432, 431, 431, 434, 435, 430, 438, 429, 440, 429, 440, 441, 441, 445, 441,
+    447, 443, 442, 450, 336, 336, 452, 336, 454, 452, 456, 454, 458, 458, 458, 460,
+    461, 462, 459, 470, 471, 459, 466, 466, 466, 472, 469, 469, 474, 475, 457, 478,
+    483, 457, 478, 479, 479, 479, 484, 485, 482, 482, 482, 488, 489, 490, 481, 494,
+    494, 495, 496, 453, 499, 453, 499, 500, 503, 504, 503, 503, 506, 507, 502, 510,
+    502, 510, 510, 511, 513, 514, 512, 518, 512, 520, 501, 522, 501, 522, 523, 526,
+    523, 523, 528, 529, 525, 532, 525, 525, 534, 535, 524, 538, 539, 538, 541, 455,
+    455, 543, 455, 545, 543, 551, 545, 547, 547, 552, 550, 550, 554, 555, 548, 558,
+    558, 558, 559, 560, 561, 544, 565, 544, 565, 566, 569, 566, 571, 568, 573, 568,
+    575, 567, 577, 578, 577, 577, 580, 581, 546, 546, 584, 586, 586, 586, 587, 588,
+    589, 585, 593, 594, 593, 593, 596, 597, 4, 4, 600, 4, 602, 600, 604, 602,
+    606, 606, 606, 608, 609, 610, 607, 614, 615, 607, 615, 615, 615, 618, 619, 620,
+    617, 624, 625, 617, 627, 605, 629, 630, 605, 631, 635, 631, 631, 631, 636, 637,
+    632, 648, 649, 632, 640, 640, 640, 640, 644, 644, 644, 650, 645, 646, 647, 643,
+    655, 601, 657, 601, 657, 658, 661, 662, 661, 661, 664, 665, 660, 668, 660, 669,
+    669, 672, 669, 669, 674, 675, 670, 678, 670, 679, 680, 659, 683, 659, 684, 686,
+    686, 688, 686, 686, 690, 691, 685, 697, 685, 694, 694, 694, 694, 698, 701, 698,
+    698, 703, 704, 699, 700, 696, 709, 603, 603, 711, 603, 713, 711, 715, 713, 717,
+    717, 717, 719, 720, 721, 718, 725, 725, 725, 726, 727, 728, 716, 740, 741, 716,
+    732, 732, 732, 732, 736, 736, 736, 742, 737, 738, 739, 739, 739, 746, 747, 748,
+    735, 752, 752, 753, 754, 712, 757, 712, 757, 758, 761, 762, 761, 761, 764, 765,
+    760, 768, 769, 768, 768, 771, 772, 759, 778, 759, 775, 775, 775, 775, 779, 782,
+    779, 779, 784, 785, 780, 781, 789, 781, 781, 791, 792, 777, 795, 796, 795, 798,
+    714, 714, 800, 714, 810, 800, 802, 802, 802, 802, 806, 806, 811, 807, 808, 809,
+    805, 816, 816, 817, 818, 801, 824, 801, 821, 821, 821, 821, 825, 828, 825, 830,
+    826, 827, 823, 834, 835, 834, 837, 803, 803, 839, 839, 839, 841, 842, 843, 840,
+    847, 840, 840, 849, 850, -854, -855, -856, -857, -858, -859, -860, -861, -862, -863, -864,
+    -865, -866, -867, -868, -869, -870, -871, -872, -873, -874, -875, -876, -877, -878, -879, -880,
+    -881, -882, -883, -884, -885, -886, -887, -888, -889, -890, -891, -892, -893, -894, -895, -896,
+    -897, -898, -899, -900, -901, -902, -903, -904, -905, -906, -907, -908, -909, -910, -911, -912,
+    -913, -914, -915, -916, -917, -918, -919, -920, -921, -922, -923, -924, -925, -926, -927, -928,
+    -929, -930, -931, -932, -933, -934, -935, -936, -937, -938, -939, -940, -941, -942, -943, -944,
+    -945, -946, -947, -948, -949, -950, -951, -952, -953, -954, -955, -956, -957, -958, -959, -960,
+    -961, -962, -963, -964, -965, -966, -967, -968, -969, -970, -971, -972, -973, -974, -975, -976,
+    -977, -978, -979, -980, -981, -982, -983, -984, -985, -986, -987, -988, -989, -990, -991, -992,
+    -993, -994, -995, -996, -997, -998, -999, -1000, -1001, -1002, -1003, -1004, -1005, -1006, -1007, -1008,
+    -1009, -1010, -1011, -1012, -1013, -1014, -1015, -1016, -1017, -1018, -1019, -1020, -1021, -1022, -1023, -1024,
+};
+
+constexpr int Fail[] = {
+    0, 0, 0, 0, 0, 1, 2, 5, 4, 7, 8, 9, 10, 0, 16, 0,
+    85, 87, 0, 88, 711, 713, 6, 3, 0, 0, 0, 170, 230, 172, 232, 231,
+    233, 233, 0, 240, 302, 0, 3, 305, 0, 0, 238, 298, 240, 249, 0, 3,
+    685, 0, 0, 242, 243, 305, 245, 759, 0, 0, 0, 0, 250, 296, 252, 298,
+    660, 249, 0, 3, 670, 0, 0, 685, 0, 712, 757, 305, 759, 0, 169, 0,
+    3, 0, 0, 803, 0, 600, 601, 602, 603, 604, 605, 0, 629, 0, 657, 658,
+    659, 660, 233, 249, 0, 3, 240, 0, 0, 668, 169, 670, 3, 669, 0, 0,
+    0, 302, 0, 3, 0, 683, 684, 685, 298, 169, 0, 3, 686, 0, 0, 249,
+    0, 3, 685, 0, 0, 696, 323, 0, 3, 0, 712, 757, 714, 759, 758, 169,
+    760, 3, 0, 0, 249, 0, 3, 0, 777, 302, 0, 3, 795, 0, 0, 800,
+    801, 0, 823, 249, 0, 3, 834, 0, 0, 1, 2, 5, 4, 7, 8, 9,
+    10, 12, 12, 0, 19, 138, 3, 140, 0, 0, 0, 16, 90, 0, 19, 86,
+    3, 632, 0, 0, 20, 0, 0, 140, 22, 23, 716, 0, 0, 85, 87, 607,
+    88, 90, 86, 3, 617, 0, 0, 0, 632, 0, 711, 713, 0, 140, 716, 0,
+    0, 6, 3, 0, 803, 0, 170, 230, 172, 232, 231, 0, 238, 0, 250, 296,
+    252, 0, 712, 169, 757, 3, 0, 0, 0, 600, 601, 602, 603, 604, 605, 12,
+    607, 86, 3, 19, 0, 0, 0, 614, 0, 0, 617, 6, 3, 615, 0, 138,
+    3, 0, 0, 629, 630, 0, 632, 90, 6, 3, 631, 0, 0, 86, 3, 632,
+    0, 0, 0, 643, 160, 3, 0, 0, 657, 658, 659, 0, 683, 0, 711, 713,
+    715, 714, 716, 718, 6, 3, 0, 0, 86, 3, 0, 0, 735, 138, 3, 752,
+    0, 0, 0, 800, 801, 805, 86, 3, 816, 0, 0, 0, 0, 1, 2, 5,
+    4, 7, 8, 9, 10, 12, 12, 0, 19, 138, 3, 140, 0, 0, 0, 16,
+    90, 0, 19, 86, 3, 632, 0, 0, 20, 0, 0, 140, 22, 23, 716, 0,
+    0, 85, 87, 607, 88, 90, 86, 3, 617, 0, 0, 0, 632, 0, 711, 713,
+    0, 140, 716, 0, 0, 6, 3, 0, 803, 0, 170, 230, 172, 232, 231, 233,
+    233, 0, 240, 302, 0, 3, 305, 0, 0, 238, 298, 240, 249, 0, 3, 685,
+    0, 0, 242, 243, 305, 245, 759, 0, 0, 0, 0, 250, 296, 252, 298, 660,
+    249, 0, 3, 670, 0, 0, 685, 0, 712, 757, 305, 759, 0, 169, 0, 3,
+    0, 0, 803, 0, 600, 601, 602, 603, 604, 605, 12, 607, 86, 3, 19, 0,
+    0, 0, 614, 0, 0, 617, 6, 3, 615, 0, 138, 3, 0, 0, 629, 630,
+    0, 632, 90, 6, 3, 631, 0, 0, 86, 3, 632, 0, 0, 0, 643, 160,
+    3, 0, 0, 657, 658, 659, 660, 233, 249, 0, 3, 240, 0, 0, 668, 169,
+    670, 3, 669, 0, 0, 0, 302, 0, 3, 0, 683, 684, 685, 298, 169, 0,
+    3, 686, 0, 0, 249, 0, 3, 685, 0, 0, 696, 323, 0, 3, 0, 711,
+    712, 713, 714, 715, 716, 0, 718, 6, 3, 0, 86, 3, 0, 0, 735, 138,
+    3, 752, 0, 0, 0, 757, 758, 759, 760, 169, 0, 3, 0, 249, 0, 3,
+    0, 777, 302, 0, 3, 795, 0, 0, 800, 801, 805, 86, 3, 816, 0, 0,
+    0, 823, 249, 0, 3, 834, 0, 0, 1, 2, 5, 4, 7, 8, 9, 10,
+    6, 3, 12, 0, 0, 0, 16, 90, 0, 19, 86, 3, 632, 0, 0, 0,
+    20, 716, 0, 140, 0, 85, 87, 607, 88, 0, 0, 86, 3, 617, 0, 0,
+    711, 0, 0, 140, 713, 6, 3, 716, 6, 3, 718, 0, 0, 0, 0, 803,
+    0, 170, 230, 172, 232, 231, 169, 0, 3, 233, 0, 0, 238, 298, 240, 0,
+    249, 0, 3, 685, 0, 0, 242, 759, 305, 0, 0, 250, 296, 252, 660, 0,
+    249, 0, 3, 670, 0, 0, 712, 0, 305, 169, 757, 3, 759, 169, 0, 3,
+    760, 0, 0, 0, 0, 803, 0, 600, 601, 602, 603, 604, 605, 12, 607, 86,
+    3, 19, 0, 0, 0, 614, 6, 3, 615, 0, 0, 0, 629, 0, 0, 632,
+    630, 6, 3, 90, 6, 3, 631, 0, 0, 0, 86, 3, 632, 0, 0, 0,
+    643, 160, 3, 0, 0, 657, 658, 659, 660, 233, 249, 0, 3, 240, 0, 0,
+    668, 169, 0, 3, 669, 0, 0, 683, 0, 685, 169, 684, 3, 298, 169, 0,
+    3, 686, 0, 0, 0, 249, 0, 3, 685, 0, 0, 696, 323, 0, 3, 0,
+    711, 712, 713, 714, 0, 716, 715, 6, 3, 718, 6, 3, 0, 0, 0, 0,
+    735, 138, 3, 0, 0, 757, 0, 759, 169, 758, 3, 760, 169, 0, 3, 0,
+    0, 0, 777, 302, 0, 3, 0, 800, 801, 6, 3, 805, 0, 0, 0, 169,
+    0, 3, 823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr int Invariants[] = {
+    0, 11, 234, 3, 803,
+};
+
+constexpr int WindowFirst[] = {
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 10, 10, 11, 11, 11, 11, 11, 11, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 18, 18, 19, 19, 19, 19, 19, 19, 20, 20,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 37, 37, 38,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 41, 42, 43,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 46, 47, 49, 50, 50, 50, 50, 50, 50, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 52, 52, 53,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 57, 57, 57, 58, 58, 58, 58, 58, 58, 58, 58, 58, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 63, 63, 63,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66, 66, 67, 67, 67,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 69, 69, 70, 70, 70, 70, 70, 70, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 74, 74, 74, 74, 74, 74, 74, 74, 75, 75,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 77, 77, 78, 78, 78, 78, 78, 78, 79, 79,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 81, 82, 83, 84, 84, 84, 84, 84, 84, 84, 84, 84, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 86, 86, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90, 90, 90, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 92, 93, 94, 94, 94, 94, 94, 94, 94, 94, 94, 95, 95, 95,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 97, 98, 99, 100, 100, 100, 100, 100, 101, 102, 103,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 105, 106, 107, 109, 109, 109, 109, 109, 110, 110, 111,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 113, 114, 115, 117, 117, 117, 117, 117, 118, 119, 120,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 122, 122, 123, 124, 124, 124, 124, 124, 125, 126, 127,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+    130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+    130, 130, 130, 130, 130, 131, 131, 132, 132, 132, 132, 132, 132, 133, 133, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 134, 134, 135, 135, 136, 136, 136, 136, 136, 136, 137, 137, 138,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+    139, 139, 140, 141, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+    142, 142, 142, 142, 142, 143, 143, 144, 145, 145, 145, 145, 145, 146, 146, 147,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+    148, 148, 149, 150, 151, 152, 152, 153, 154, 154, 154, 154, 154, 154, 154, 154,
+    154, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156, 156,
+    156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    156, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 158, 159,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+    160, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 162, 163, 164,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    165, 166, 168, 170, 171, 171, 171, 171, 171, 171, 171, 171, 171, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    172, 172, 172, 172, 172, 172, 173, 173, 174, 174, 174, 174, 174, 174, 175, 175,
+    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+    175, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 178, 178, 178, 178, 178, 178, 178, 178, 179, 179,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 181, 181, 182, 182, 182, 182, 182, 182, 183, 183,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 185, 186,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+    187, 187, 188, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    189, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192, 192,
+    192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+    192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+    192, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    194, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 196, 196, 196,
+    197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+    197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+    197, 198, 198, 198, 199, 199, 199, 199, 199, 199, 199, 199, 199, 200, 200, 200,
+    201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+    201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+    201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+    201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+    201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+    201, 201, 201, 201, 201, 201, 202, 202, 202, 202, 202, 202, 202, 202, 203, 203,
+    203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+    203, 203, 203, 203, 203, 203, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+    204, 204, 204, 204, 204, 204, 205, 205, 205, 205, 205, 205, 205, 205, 206, 206,
+    206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+    206, 206, 206, 206, 206, 207, 208, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+    210, 211, 211, 211, 212, 212, 212, 212, 212, 212, 212, 212, 212, 213, 213, 213,
+    213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+    213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+    213, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 217, 217, 217,
+    218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+    218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+    218, 219, 219, 219, 220, 220, 220, 220, 220, 220, 220, 220, 220, 221, 221, 221,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    222, 222, 222, 222, 222, 222, 223, 223, 224, 224, 224, 224, 224, 224, 225, 225,
+    225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+    225, 225, 225, 225, 225, 225, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+    227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+    227, 227, 227, 227, 227, 227, 228, 228, 228, 228, 228, 228, 228, 228, 229, 229,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 231, 231, 232, 232, 232, 232, 232, 232, 233, 233,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 235, 236, 237, 238, 238, 238, 238, 238, 238, 238, 238, 238, 239, 240, 241,
+    242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 243, 244, 245, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 248, 249,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+    250, 251, 252, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 256, 257, 258,
+    259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259,
+    259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259,
+    259, 259, 260, 261, 262, 262, 262, 262, 262, 262, 262, 262, 262, 263, 264, 265,
+    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
+    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
+    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
+    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
+    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
+    266, 266, 266, 266, 266, 267, 268, 269, 270, 270, 270, 270, 270, 270, 271, 271,
+    271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+    271, 271, 271, 271, 271, 271, 272, 272, 273, 273, 273, 273, 273, 273, 273, 273,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 275, 275, 276, 276, 276, 276, 276, 276, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 278, 278, 279, 280, 280, 280, 280, 280, 280, 281, 281,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+    282, 282, 283, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 285, 286,
+    286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286,
+    286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286,
+    286, 286, 287, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 289, 290,
+    291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291,
+    291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291,
+    291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291,
+    291, 291, 291, 291, 291, 292, 292, 293, 293, 293, 293, 293, 293, 293, 293, 293,
+    293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293,
+    293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293,
+    293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293,
+    293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293,
+    293, 293, 294, 295, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 297, 298,
+    299, 299, 299, 299, 299, 300, 300, 301, 302, 302, 302, 302, 302, 302, 302, 302,
+    302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302,
+    302, 302, 303, 304, 305, 306, 306, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 310, 310, 310,
+    310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+    310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+    310, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 312, 313,
+    314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+    314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+    314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+    314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+    314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+    314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+    314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+    314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+    314, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 316, 317, 318,
+    319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319,
+    319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319,
+    319, 320, 322, 324, 325, 325, 325, 325, 325, 325, 325, 325, 325, 326, 326, 326,
+    326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326,
+    326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326,
+    326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326,
+    326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326,
+    326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326,
+    326, 326, 326, 326, 326, 326, 327, 327, 328, 328, 328, 328, 328, 328, 329, 329,
+    329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329,
+    329, 329, 329, 329, 329, 329, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+    331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331,
+    331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331,
+    331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331,
+    331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331,
+    331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331,
+    331, 331, 331, 331, 331, 331, 332, 332, 332, 332, 332, 332, 332, 332, 333, 333,
+    334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 334, 334,
+    334, 334, 334, 334, 334, 334, 335, 335, 336, 336, 336, 336, 336, 336, 337, 337,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 339, 340,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341,
+    341, 341, 342, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+    343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+    343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+    343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+    343, 344, 344, 344, 345, 345, 345, 345, 345, 345, 345, 345, 345, 346, 346, 346,
+    346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+    346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+    346, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+    348, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 350, 350, 350,
+    351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351,
+    351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351,
+    351, 352, 352, 352, 353, 353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354,
+    355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+    355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+    355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+    355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+    355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+    355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356, 357, 357,
+    357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+    357, 357, 357, 357, 357, 357, 358, 358, 358, 358, 358, 358, 358, 359, 359, 360,
+    361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+    361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+    361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+    361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+    361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+    361, 361, 361, 361, 361, 361, 362, 362, 362, 362, 362, 362, 362, 363, 364, 365,
+    366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+    366, 366, 366, 366, 366, 368, 369, 371, 372, 372, 372, 372, 372, 372, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+    373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 374, 374, 375,
+    376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    376, 376, 376, 376, 376, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378, 378,
+    378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378,
+    378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378,
+    378, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380, 380, 381, 381, 381,
+    381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+    381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+    381, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+    383, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 385, 385, 385,
+    386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386,
+    386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386,
+    386, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388, 388, 389, 389, 389,
+    390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390,
+    390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390,
+    390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390,
+    390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390,
+    390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390,
+    390, 390, 390, 390, 390, 390, 391, 391, 392, 392, 392, 392, 392, 392, 393, 393,
+    393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393,
+    393, 393, 393, 393, 393, 393, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+    395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+    395, 395, 395, 395, 395, 395, 396, 396, 396, 396, 396, 396, 396, 396, 397, 397,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 398, 398, 398, 398, 399, 399, 400, 400, 400, 400, 400, 400, 401, 401,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 403, 404, 405, 406, 406, 406, 406, 406, 406, 406, 406, 406, 407, 408, 409,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 411, 412, 413, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 416, 417,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 419, 420, 421, 423, 423, 423, 423, 423, 423, 423, 423, 423, 424, 425, 426,
+    427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427,
+    427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427, 427,
+    427, 427, 428, 429, 430, 430, 430, 430, 430, 430, 430, 430, 430, 431, 432, 433,
+    434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434,
+    434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434,
+    434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434,
+    434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434,
+    434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434,
+    434, 434, 434, 434, 434, 435, 436, 437, 438, 438, 438, 438, 438, 439, 440, 441,
+    442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442,
+    442, 442, 442, 442, 442, 443, 444, 445, 447, 447, 447, 447, 447, 448, 448, 449,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    450, 450, 450, 450, 450, 451, 452, 453, 455, 455, 455, 455, 455, 456, 457, 458,
+    459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+    459, 459, 459, 459, 459, 460, 460, 461, 462, 462, 462, 462, 462, 463, 464, 465,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 467, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 469, 470,
+    470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470,
+    470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470,
+    470, 470, 471, 472, 472, 472, 472, 472, 472, 472, 472, 472, 472, 472, 473, 474,
+    475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475,
+    475, 475, 475, 475, 475, 476, 476, 477, 477, 477, 477, 477, 477, 478, 478, 479,
+    479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479,
+    479, 479, 479, 479, 479, 480, 480, 481, 481, 481, 481, 481, 481, 482, 482, 483,
+    484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484,
+    484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484,
+    484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484,
+    484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484,
+    484, 484, 485, 486, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 488, 489,
+    490, 490, 490, 490, 490, 491, 491, 492, 493, 493, 493, 493, 493, 494, 494, 495,
+    496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496,
+    496, 496, 497, 498, 499, 500, 500, 501, 502, 502, 502, 502, 502, 502, 502, 502,
+    502, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 504, 504, 504,
+    504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+    504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+    504, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+    505, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506, 507, 508, 509,
+    510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510,
+    510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510,
+    510, 511, 512, 513, 514, 514, 514, 514, 514, 514, 514, 514, 514, 515, 515, 515,
+    515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515,
+    515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515,
+    515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515,
+    515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515,
+    515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515,
+    515, 515, 515, 515, 515, 515, 516, 516, 517, 517, 517, 517, 517, 517, 518, 518,
+    518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518,
+    518, 518, 518, 518, 518, 518, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519,
+    520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520,
+    520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520,
+    520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520,
+    520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520,
+    520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520, 520,
+    520, 520, 520, 520, 520, 520, 521, 521, 521, 521, 521, 521, 521, 521, 522, 522,
+    523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523,
+    523, 523, 523, 523, 523, 523, 524, 524, 525, 525, 525, 525, 525, 525, 526, 526,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+    527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 528, 529,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 530,
+    530, 530, 531, 532, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533,
+    533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533,
+    533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533,
+    533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533,
+    533, 534, 534, 534, 535, 535, 535, 535, 535, 535, 535, 535, 535, 536, 536, 536,
+    536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536,
+    536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536,
+    536, 537, 537, 537, 537, 537, 537, 537, 537, 537, 537, 537, 537, 537, 537, 537,
+    538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+    538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+    538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+    538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+    538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+    538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+    538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+    538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+    538, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 540, 540, 540,
+    541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541,
+    541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541,
+    541, 542, 542, 542, 543, 543, 543, 543, 543, 543, 543, 543, 543, 544, 544, 544,
+    545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545,
+    545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545,
+    545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545,
+    545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545,
+    545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545,
+    545, 545, 545, 545, 545, 545, 546, 546, 546, 546, 546, 546, 546, 546, 547, 547,
+    547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+    547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+    548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+    548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+    548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+    548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+    548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+    548, 548, 548, 548, 548, 548, 549, 549, 549, 549, 549, 549, 549, 550, 551, 552,
+    553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553, 553,
+    553, 553, 553, 553, 553, 554, 555, 556, 557, 557, 557, 557, 557, 557, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+    558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 559, 559, 560,
+    561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+    561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+    561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+    561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+    561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+    561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+    561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+    561, 561, 561, 561, 561, 562, 562, 563, 564, 564, 564, 564, 564, 564, 564, 564,
+    564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564,
+    564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564,
+    564, 565, 565, 565, 566, 566, 566, 566, 566, 566, 566, 566, 566, 567, 567, 567,
+    567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+    567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+    567, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568,
+    569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+    569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+    569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+    569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+    569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+    569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+    569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+    569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+    569, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 571, 571, 571,
+    572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572,
+    572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572,
+    572, 573, 573, 573, 574, 574, 574, 574, 574, 574, 574, 574, 574, 575, 575, 575,
+    576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+    576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+    576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+    576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+    576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+    576, 576, 576, 576, 576, 576, 577, 577, 578, 578, 578, 578, 578, 578, 579, 579,
+    579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579,
+    579, 579, 579, 579, 579, 579, 580, 580, 580, 580, 580, 580, 580, 580, 580, 580,
+    581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581,
+    581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581,
+    581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581,
+    581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581,
+    581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581,
+    581, 581, 581, 581, 581, 581, 582, 582, 582, 582, 582, 582, 582, 582, 583, 583,
+    584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584,
+    584, 584, 584, 584, 584, 584, 585, 585, 586, 586, 586, 586, 586, 586, 587, 587,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588,
+    588, 589, 590, 591, 592, 592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595,
+    596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+    596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+    596, 597, 598, 599, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+    602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+    602, 603, 604, 605, 607, 607, 607, 607, 607, 607, 607, 607, 607, 608, 609, 610,
+    611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+    611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+    611, 611, 612, 613, 614, 614, 614, 614, 614, 614, 614, 614, 614, 615, 616, 617,
+    618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618,
+    618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618,
+    618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618,
+    618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618,
+    618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618,
+    618, 618, 618, 618, 618, 619, 620, 621, 622, 622, 622, 622, 622, 623, 624, 625,
+    626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626,
+    626, 626, 626, 626, 626, 627, 628, 629, 631, 631, 631, 631, 631, 631, 631, 631,
+    632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+    632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+    632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+    632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+    632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+    632, 632, 632, 632, 632, 633, 634, 635, 637, 637, 637, 637, 637, 638, 639, 640,
+    641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641,
+    641, 641, 641, 641, 641, 642, 642, 643, 644, 644, 644, 644, 644, 645, 646, 647,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+    648, 648, 649, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650,
+    650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650,
+    650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650,
+    650, 650, 651, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 653, 654,
+    654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654,
+    654, 654, 654, 654, 654, 655, 655, 656, 656, 656, 656, 656, 656, 656, 656, 656,
+    656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656, 656,
+    656, 656, 656, 656, 656, 657, 657, 658, 658, 658, 658, 658, 658, 659, 659, 660,
+    660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660,
+    660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660,
+    660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660,
+    660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660, 660,
+    660, 660, 661, 662, 663, 663, 663, 663, 663, 663, 663, 663, 663, 663, 663, 663,
+    663, 663, 663, 663, 663, 664, 664, 665, 666, 666, 666, 666, 666, 666, 666, 666,
+    666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666,
+    666, 666, 667, 668, 669, 670, 670, 671, 672, 672, 672, 672, 672, 672, 672, 672,
+    672,
+};
+
+constexpr int WindowPatterns[] = {
+    0, 1, 2, 26, 27, 3, 4, 5, 51, 75, 6, 76, 77, 16, 97, 98,
+    20, 21, 24, 109, 25, 0, 55, 1, 2, 65, 26, 27, 69, 70, 73, 51,
+    74, 75, 76, 77, 7, 8, 9, 97, 10, 98, 11, 12, 13, 78, 79, 14,
+    80, 15, 109, 17, 18, 19, 22, 23, 0, 110, 1, 2, 120, 26, 27, 124,
+    125, 128, 51, 129, 75, 130, 76, 77, 140, 97, 98, 144, 145, 148, 109, 149,
+    0, 202, 203, 204, 1, 2, 205, 210, 26, 211, 27, 218, 219, 220, 51, 221,
+    222, 75, 223, 224, 28, 76, 29, 30, 31, 77, 32, 33, 225, 34, 35, 230,
+    36, 97, 37, 38, 231, 39, 98, 40, 41, 235, 239, 240, 42, 109, 43, 241,
+    251, 252, 44, 45, 46, 47, 264, 268, 48, 49, 50, 276, 277, 278, 281, 284,
+    285, 52, 53, 54, 288, 289, 290, 291, 292, 293, 0, 1, 2, 56, 57, 58,
+    26, 27, 59, 60, 61, 3, 62, 4, 63, 5, 64, 51, 75, 6, 76, 77,
+    16, 97, 98, 20, 21, 24, 109, 25, 66, 67, 68, 71, 72, 0, 55, 1,
+    2, 65, 26, 27, 69, 70, 73, 51, 74, 75, 76, 77, 97, 98, 78, 79,
+    80, 109, 0, 110, 1, 2, 120, 26, 27, 124, 125, 128, 51, 129, 75, 130,
+    76, 77, 140, 97, 98, 144, 145, 148, 109, 149, 0, 202, 203, 204, 1, 81,
+    82, 83, 2, 84, 85, 86, 205, 87, 88, 210, 26, 89, 90, 91, 211, 27,
+    92, 93, 94, 218, 219, 220, 51, 95, 96, 221, 222, 75, 223, 224, 76, 77,
+    225, 230, 97, 231, 98, 235, 239, 240, 109, 241, 99, 100, 101, 102, 251, 252,
+    103, 104, 105, 264, 268, 276, 277, 278, 106, 107, 108, 281, 284, 285, 288, 289,
+    290, 291, 292, 293, 0, 1, 2, 111, 112, 113, 26, 27, 114, 115, 116, 3,
+    117, 4, 118, 5, 119, 51, 75, 6, 76, 77, 16, 97, 98, 20, 21, 24,
+    109, 25, 121, 122, 123, 126, 127, 0, 55, 1, 2, 65, 26, 27, 69, 70,
+    73, 51, 74, 75, 76, 77, 131, 132, 133, 97, 134, 98, 135, 136, 137, 78,
+    79, 138, 80, 139, 109, 141, 142, 143, 146, 147, 0, 110, 1, 2, 120, 26,
+    27, 124, 125, 128, 51, 129, 75, 130, 76, 77, 140, 97, 98, 144, 145, 148,
+    109, 149, 0, 202, 203, 204, 1, 150, 151, 152, 2, 153, 154, 155, 205, 156,
+    157, 210, 26, 158, 159, 160, 211, 27, 161, 162, 163, 218, 219, 220, 51, 164,
+    165, 221, 222, 75, 223, 224, 166, 76, 167, 168, 169, 77, 170, 171, 225, 172,
+    173, 230, 174, 97, 175, 176, 231, 177, 98, 178, 179, 235, 239, 240, 180, 109,
+    181, 241, 182, 183, 184, 185, 251, 252, 186, 187, 188, 189, 190, 191, 192, 264,
+    268, 193, 194, 195, 276, 277, 278, 196, 197, 198, 281, 284, 285, 199, 200, 201,
+    288, 289, 290, 291, 292, 293, 0, 1, 2, 26, 27, 206, 207, 208, 3, 4,
+    5, 209, 51, 75, 6, 76, 77, 16, 97, 98, 20, 21, 24, 109, 25, 212,
+    213, 214, 215, 216, 217, 0, 55, 1, 2, 65, 26, 27, 69, 70, 73, 51,
+    74, 75, 76, 77, 97, 226, 98, 227, 228, 78, 79, 80, 229, 109, 232, 233,
+    234, 236, 237, 238, 0, 110, 1, 2, 120, 26, 27, 124, 125, 128, 51, 129,
+    75, 130, 76, 77, 140, 97, 98, 144, 145, 148, 109, 149, 0, 202, 203, 204,
+    1, 242, 243, 244, 2, 245, 246, 247, 205, 210, 26, 248, 249, 250, 211, 27,
+    253, 254, 255, 218, 219, 220, 51, 256, 257, 221, 222, 75, 223, 224, 258, 76,
+    259, 260, 261, 77, 262, 263, 225, 230, 265, 97, 266, 267, 231, 269, 98, 270,
+    271, 235, 239, 240, 272, 109, 273, 241, 274, 275, 251, 252, 279, 280, 282, 283,
+    264, 268, 286, 287, 276, 277, 278, 281, 284, 285, 288, 289, 290, 291, 292, 293,
+};
+
+constexpr Pattern Patterns[] = {
+    { "+xxxxx", Pattern::Five, 9999 },
+    { "+xxx_x", Pattern::DeadFour, 3000 },
+    { "+xx_xx", Pattern::DeadFour, 2600 },
+    { "+xx__xx", Pattern::DeadThree, 540 },
+    { "+xx__xo", Pattern::DeadThree, 530 },
+    { "+xx__x?", Pattern::DeadThree, 530 },
+    { "-xoooo_", Pattern::DeadFour, 2500 },
+    { "-xooo__x", Pattern::DeadThree, 500 },
+    { "-xooo__?", Pattern::DeadThree, 500 },
+    { "-xooo__~", Pattern::DeadThree, 510 },
+    { "-xoo_o_x", Pattern::DeadThree, 500 },
+    { "-xoo_o_?", Pattern::DeadThree, 500 },
+    { "-xoo_o_~", Pattern::DeadThree, 520 },
+    { "-xoo__ox", Pattern::DeadThree, 500 },
+    { "-xoo__o?", Pattern::DeadThree, 500 },
+    { "-xoo__o~", Pattern::DeadThree, 520 },
+    { "-xoo___", Pattern::DeadTwo, 150 },
+    { "-xo_oo_x", Pattern::DeadThree, 500 },
+    { "-xo_oo_?", Pattern::DeadThree, 500 },
+    { "-xo_oo_~", Pattern::DeadThree, 530 },
+    { "-xo_o__", Pattern::DeadTwo, 160 },
+    { "-xo__oo", Pattern::DeadThree, 530 },
+    { "-xo__oox", Pattern::DeadThree, 500 },
+    { "-xo__oo?", Pattern::DeadThree, 500 },
+    { "-xo__o_", Pattern::DeadTwo, 170 },
+    { "-xo___~", Pattern::DeadOne, 30 },
+    { "+x_xxx", Pattern::DeadFour, 3000 },
+    { "+x_x_x", Pattern::DeadThree, 550 },
+    { "-x_ooo_x", Pattern::DeadThree, 500 },
+    { "-x_ooo_?", Pattern::DeadThree, 500 },
+    { "-x^ooo_~", Pattern::LiveThree, 2900 },
+    { "-x_oo_ox", Pattern::DeadThree, 500 },
+    { "-x_oo_o?", Pattern::DeadThree, 500 },
+    { "-x_oo~o~", Pattern::DeadThree, 1100 },
+    { "-x_oo__x", Pattern::DeadTwo, 120 },
+    { "-x_oo__?", Pattern::DeadTwo, 120 },
+    { "-x_o_oox", Pattern::DeadThree, 500 },
+    { "-x_o_oo?", Pattern::DeadThree, 500 },
+    { "-x_o~oo~", Pattern::DeadThree, 1300 },
+    { "-x_o_o_x", Pattern::DeadTwo, 120 },
+    { "-x_o_o_?", Pattern::DeadTwo, 120 },
+    { "-x^o_o_^", Pattern::LiveTwo, 550 },
+    { "-x_o___x", Pattern::DeadOne, 40 },
+    { "-x_o___?", Pattern::DeadOne, 40 },
+    { "-x__ooox", Pattern::DeadThree, 500 },
+    { "-x__ooo?", Pattern::DeadThree, 500 },
+    { "-x__oo_x", Pattern::DeadTwo, 120 },
+    { "-x__oo_?", Pattern::DeadTwo, 120 },
+    { "-x__o__x", Pattern::DeadOne, 50 },
+    { "-x__o__?", Pattern::DeadOne, 50 },
+    { "-x~_o__^", Pattern::LiveOne, 140 },
+    { "+x___x", Pattern::DeadTwo, 180 },
+    { "-x___o_x", Pattern::DeadOne, 40 },
+    { "-x___o_?", Pattern::DeadOne, 40 },
+    { "-x~__o_^", Pattern::LiveOne, 150 },
+    { "+oxxxx_", Pattern::DeadFour, 2500 },
+    { "+oxxx__o", Pattern::DeadThree, 500 },
+    { "+oxxx__?", Pattern::DeadThree, 500 },
+    { "+oxxx__~", Pattern::DeadThree, 510 },
+    { "+oxx_x_o", Pattern::DeadThree, 500 },
+    { "+oxx_x_?", Pattern::DeadThree, 500 },
+    { "+oxx_x_~", Pattern::DeadThree, 520 },
+    { "+oxx__xo", Pattern::DeadThree, 500 },
+    { "+oxx__x?", Pattern::DeadThree, 500 },
+    { "+oxx__x~", Pattern::DeadThree, 520 },
+    { "+oxx___", Pattern::DeadTwo, 150 },
+    { "+ox_xx_o", Pattern::DeadThree, 500 },
+    { "+ox_xx_?", Pattern::DeadThree, 500 },
+    { "+ox_xx_~", Pattern::DeadThree, 530 },
+    { "+ox_x__", Pattern::DeadTwo, 160 },
+    { "+ox__xx", Pattern::DeadThree, 530 },
+    { "+ox__xxo", Pattern::DeadThree, 500 },
+    { "+ox__xx?", Pattern::DeadThree, 500 },
+    { "+ox__x_", Pattern::DeadTwo, 170 },
+    { "+ox___~", Pattern::DeadOne, 30 },
+    { "-ooooo", Pattern::Five, 9999 },
+    { "-ooo_o", Pattern::DeadFour, 3000 },
+    { "-oo_oo", Pattern::DeadFour, 2600 },
+    { "-oo__ox", Pattern::DeadThree, 530 },
+    { "-oo__oo", Pattern::DeadThree, 540 },
+    { "-oo__o?", Pattern::DeadThree, 530 },
+    { "+o_xxx_o", Pattern::DeadThree, 500 },
+    { "+o_xxx_?", Pattern::DeadThree, 500 },
+    { "+o^xxx_~", Pattern::LiveThree, 2900 },
+    { "+o_xx_xo", Pattern::DeadThree, 500 },
+    { "+o_xx_x?", Pattern::DeadThree, 500 },
+    { "+o_xx~x~", Pattern::DeadThree, 1100 },
+    { "+o_xx__o", Pattern::DeadTwo, 120 },
+    { "+o_xx__?", Pattern::DeadTwo, 120 },
+    { "+o_x_xxo", Pattern::DeadThree, 500 },
+    { "+o_x_xx?", Pattern::DeadThree, 500 },
+    { "+o_x~xx~", Pattern::DeadThree, 1300 },
+    { "+o_x_x_o", Pattern::DeadTwo, 120 },
+    { "+o_x_x_?", Pattern::DeadTwo, 120 },
+    { "+o^x_x_^", Pattern::LiveTwo, 550 },
+    { "+o_x___o", Pattern::DeadOne, 40 },
+    { "+o_x___?", Pattern::DeadOne, 40 },
+    { "-o_ooo", Pattern::DeadFour, 3000 },
+    { "-o_o_o", Pattern::DeadThree, 550 },
+    { "+o__xxxo", Pattern::DeadThree, 500 },
+    { "+o__xxx?", Pattern::DeadThree, 500 },
+    { "+o__xx_o", Pattern::DeadTwo, 120 },
+    { "+o__xx_?", Pattern::DeadTwo, 120 },
+    { "+o__x__o", Pattern::DeadOne, 50 },
+    { "+o__x__?", Pattern::DeadOne, 50 },
+    { "+o~_x__^", Pattern::LiveOne, 140 },
+    { "+o___x_o", Pattern::DeadOne, 40 },
+    { "+o___x_?", Pattern::DeadOne, 40 },
+    { "+o~__x_^", Pattern::LiveOne, 150 },
+    { "-o___o", Pattern::DeadTwo, 180 },
+    { "+?xxxx_", Pattern::DeadFour, 2500 },
+    { "+?xxx__o", Pattern::DeadThree, 500 },
+    { "+?xxx__?", Pattern::DeadThree, 500 },
+    { "+?xxx__~", Pattern::DeadThree, 510 },
+    { "+?xx_x_o", Pattern::DeadThree, 500 },
+    { "+?xx_x_?", Pattern::DeadThree, 500 },
+    { "+?xx_x_~", Pattern::DeadThree, 520 },
+    { "+?xx__xo", Pattern::DeadThree, 500 },
+    { "+?xx__x?", Pattern::DeadThree, 500 },
+    { "+?xx__x~", Pattern::DeadThree, 520 },
+    { "+?xx___", Pattern::DeadTwo, 150 },
+    { "+?x_xx_o", Pattern::DeadThree, 500 },
+    { "+?x_xx_?", Pattern::DeadThree, 500 },
+    { "+?x_xx_~", Pattern::DeadThree, 530 },
+    { "+?x_x__", Pattern::DeadTwo, 160 },
+    { "+?x__xx", Pattern::DeadThree, 530 },
+    { "+?x__xxo", Pattern::DeadThree, 500 },
+    { "+?x__xx?", Pattern::DeadThree, 500 },
+    { "+?x__x_", Pattern::DeadTwo, 170 },
+    { "+?x___~", Pattern::DeadOne, 30 },
+    { "-?oooo_", Pattern::DeadFour, 2500 },
+    { "-?ooo__x", Pattern::DeadThree, 500 },
+    { "-?ooo__?", Pattern::DeadThree, 500 },
+    { "-?ooo__~", Pattern::DeadThree, 510 },
+    { "-?oo_o_x", Pattern::DeadThree, 500 },
+    { "-?oo_o_?", Pattern::DeadThree, 500 },
+    { "-?oo_o_~", Pattern::DeadThree, 520 },
+    { "-?oo__ox", Pattern::DeadThree, 500 },
+    { "-?oo__o?", Pattern::DeadThree, 500 },
+    { "-?oo__o~", Pattern::DeadThree, 520 },
+    { "-?oo___", Pattern::DeadTwo, 150 },
+    { "-?o_oo_x", Pattern::DeadThree, 500 },
+    { "-?o_oo_?", Pattern::DeadThree, 500 },
+    { "-?o_oo_~", Pattern::DeadThree, 530 },
+    { "-?o_o__", Pattern::DeadTwo, 160 },
+    { "-?o__oo", Pattern::DeadThree, 530 },
+    { "-?o__oox", Pattern::DeadThree, 500 },
+    { "-?o__oo?", Pattern::DeadThree, 500 },
+    { "-?o__o_", Pattern::DeadTwo, 170 },
+    { "-?o___~", Pattern::DeadOne, 30 },
+    { "+?_xxx_o", Pattern::DeadThree, 500 },
+    { "+?_xxx_?", Pattern::DeadThree, 500 },
+    { "+?^xxx_~", Pattern::LiveThree, 2900 },
+    { "+?_xx_xo", Pattern::DeadThree, 500 },
+    { "+?_xx_x?", Pattern::DeadThree, 500 },
+    { "+?_xx~x~", Pattern::DeadThree, 1100 },
+    { "+?_xx__o", Pattern::DeadTwo, 120 },
+    { "+?_xx__?", Pattern::DeadTwo, 120 },
+    { "+?_x_xxo", Pattern::DeadThree, 500 },
+    { "+?_x_xx?", Pattern::DeadThree, 500 },
+    { "+?_x~xx~", Pattern::DeadThree, 1300 },
+    { "+?_x_x_o", Pattern::DeadTwo, 120 },
+    { "+?_x_x_?", Pattern::DeadTwo, 120 },
+    { "+?^x_x_^", Pattern::LiveTwo, 550 },
+    { "+?_x___o", Pattern::DeadOne, 40 },
+    { "+?_x___?", Pattern::DeadOne, 40 },
+    { "-?_ooo_x", Pattern::DeadThree, 500 },
+    { "-?_ooo_?", Pattern::DeadThree, 500 },
+    { "-?^ooo_~", Pattern::LiveThree, 2900 },
+    { "-?_oo_ox", Pattern::DeadThree, 500 },
+    { "-?_oo_o?", Pattern::DeadThree, 500 },
+    { "-?_oo~o~", Pattern::DeadThree, 1100 },
+    { "-?_oo__x", Pattern::DeadTwo, 120 },
+    { "-?_oo__?", Pattern::DeadTwo, 120 },
+    { "-?_o_oox", Pattern::DeadThree, 500 },
+    { "-?_o_oo?", Pattern::DeadThree, 500 },
+    { "-?_o~oo~", Pattern::DeadThree, 1300 },
+    { "-?_o_o_x", Pattern::DeadTwo, 120 },
+    { "-?_o_o_?", Pattern::DeadTwo, 120 },
+    { "-?^o_o_^", Pattern::LiveTwo, 550 },
+    { "-?_o___x", Pattern::DeadOne, 40 },
+    { "-?_o___?", Pattern::DeadOne, 40 },
+    { "+?__xxxo", Pattern::DeadThree, 500 },
+    { "+?__xxx?", Pattern::DeadThree, 500 },
+    { "+?__xx_o", Pattern::DeadTwo, 120 },
+    { "+?__xx_?", Pattern::DeadTwo, 120 },
+    { "+?__x__o", Pattern::DeadOne, 50 },
+    { "+?__x__?", Pattern::DeadOne, 50 },
+    { "+?~_x__^", Pattern::LiveOne, 140 },
+    { "-?__ooox", Pattern::DeadThree, 500 },
+    { "-?__ooo?", Pattern::DeadThree, 500 },
+    { "-?__oo_x", Pattern::DeadTwo, 120 },
+    { "-?__oo_?", Pattern::DeadTwo, 120 },
+    { "-?__o__x", Pattern::DeadOne, 50 },
+    { "-?__o__?", Pattern::DeadOne, 50 },
+    { "-?~_o__^", Pattern::LiveOne, 140 },
+    { "+?___x_o", Pattern::DeadOne, 40 },
+    { "+?___x_?", Pattern::DeadOne, 40 },
+    { "+?~__x_^", Pattern::LiveOne, 150 },
+    { "-?___o_x", Pattern::DeadOne, 40 },
+    { "-?___o_?", Pattern::DeadOne, 40 },
+    { "-?~__o_^", Pattern::LiveOne, 150 },
+    { "+_xxxxo", Pattern::DeadFour, 2500 },
+    { "+_xxxx?", Pattern::DeadFour, 2500 },
+    { "+_xxxx_", Pattern::LiveFour, 9000 },
+    { "+~xx_x~", Pattern::LiveThree, 2800 },
+    { "+~xx~x_o", Pattern::DeadThree, 1300 },
+    { "+~xx~x_?", Pattern::DeadThree, 1300 },
+    { "+~xx~x_~", Pattern::DeadThree, 1200 },
+    { "+~xx__x~", Pattern::DeadThree, 750 },
+    { "+~xx__~", Pattern::LiveTwo, 650 },
+    { "+~x_xx~", Pattern::LiveThree, 2800 },
+    { "+~x~xx_o", Pattern::DeadThree, 1100 },
+    { "+~x~xx_?", Pattern::DeadThree, 1100 },
+    { "+~x~xx_~", Pattern::DeadThree, 1400 },
+    { "+~x__xxo", Pattern::DeadThree, 520 },
+    { "+~x__xx?", Pattern::DeadThree, 520 },
+    { "+~x__xx~", Pattern::DeadThree, 750 },
+    { "+_x__xo", Pattern::DeadTwo, 170 },
+    { "+_x__x?", Pattern::DeadTwo, 170 },
+    { "+^x__x^", Pattern::LiveTwo, 550 },
+    { "+~x___~", Pattern::LiveOne, 150 },
+    { "-_oooox", Pattern::DeadFour, 2500 },
+    { "-_oooo?", Pattern::DeadFour, 2500 },
+    { "-_oooo_", Pattern::LiveFour, 9000 },
+    { "-~oo_o~", Pattern::LiveThree, 2800 },
+    { "-~oo~o_x", Pattern::DeadThree, 1300 },
+    { "-~oo~o_?", Pattern::DeadThree, 1300 },
+    { "-~oo~o_~", Pattern::DeadThree, 1200 },
+    { "-~oo__o~", Pattern::DeadThree, 750 },
+    { "-~oo__~", Pattern::LiveTwo, 650 },
+    { "-~o_oo~", Pattern::LiveThree, 2800 },
+    { "-~o~oo_x", Pattern::DeadThree, 1100 },
+    { "-~o~oo_?", Pattern::DeadThree, 1100 },
+    { "-~o~oo_~", Pattern::DeadThree, 1400 },
+    { "-_o__ox", Pattern::DeadTwo, 170 },
+    { "-~o__oox", Pattern::DeadThree, 520 },
+    { "-~o__oo?", Pattern::DeadThree, 520 },
+    { "-~o__oo~", Pattern::DeadThree, 750 },
+    { "-_o__o?", Pattern::DeadTwo, 170 },
+    { "-^o__o^", Pattern::LiveTwo, 550 },
+    { "-~o___~", Pattern::LiveOne, 150 },
+    { "+~_xxx^o", Pattern::LiveThree, 2900 },
+    { "+~_xxx^?", Pattern::LiveThree, 2900 },
+    { "+~_xxx_~", Pattern::LiveThree, 3000 },
+    { "+~_xx_xo", Pattern::DeadThree, 530 },
+    { "+~_xx_x?", Pattern::DeadThree, 530 },
+    { "+~_xx~x~", Pattern::DeadThree, 1400 },
+    { "+~_x_xxo", Pattern::DeadThree, 520 },
+    { "+~_x_xx?", Pattern::DeadThree, 520 },
+    { "+~_x~xx~", Pattern::DeadThree, 1200 },
+    { "+__x_xo", Pattern::DeadTwo, 160 },
+    { "+__x_x?", Pattern::DeadTwo, 160 },
+    { "+^_x_x^o", Pattern::LiveTwo, 550 },
+    { "+^_x_x^?", Pattern::LiveTwo, 550 },
+    { "+~_x_x_~", Pattern::LiveTwo, 600 },
+    { "+^_x__~o", Pattern::LiveOne, 150 },
+    { "+^_x__~?", Pattern::LiveOne, 150 },
+    { "-~_ooo^x", Pattern::LiveThree, 2900 },
+    { "-~_ooo^?", Pattern::LiveThree, 2900 },
+    { "-~_ooo_~", Pattern::LiveThree, 3000 },
+    { "-~_oo_ox", Pattern::DeadThree, 530 },
+    { "-~_oo_o?", Pattern::DeadThree, 530 },
+    { "-~_oo~o~", Pattern::DeadThree, 1400 },
+    { "-__o_ox", Pattern::DeadTwo, 160 },
+    { "-~_o_oox", Pattern::DeadThree, 520 },
+    { "-~_o_oo?", Pattern::DeadThree, 520 },
+    { "-~_o~oo~", Pattern::DeadThree, 1200 },
+    { "-__o_o?", Pattern::DeadTwo, 160 },
+    { "-^_o_o^x", Pattern::LiveTwo, 550 },
+    { "-^_o_o^?", Pattern::LiveTwo, 550 },
+    { "-~_o_o_~", Pattern::LiveTwo, 600 },
+    { "-^_o__~x", Pattern::LiveOne, 150 },
+    { "-^_o__~?", Pattern::LiveOne, 150 },
+    { "+~__xxxo", Pattern::DeadThree, 510 },
+    { "+~__xxx?", Pattern::DeadThree, 510 },
+    { "+___xxo", Pattern::DeadTwo, 150 },
+    { "+___xx?", Pattern::DeadTwo, 150 },
+    { "+~__xx~", Pattern::LiveTwo, 650 },
+    { "+^__x_~o", Pattern::LiveOne, 140 },
+    { "+^__x_~?", Pattern::LiveOne, 140 },
+    { "-___oox", Pattern::DeadTwo, 150 },
+    { "-~__ooox", Pattern::DeadThree, 510 },
+    { "-~__ooo?", Pattern::DeadThree, 510 },
+    { "-___oo?", Pattern::DeadTwo, 150 },
+    { "-~__oo~", Pattern::LiveTwo, 650 },
+    { "-^__o_~x", Pattern::LiveOne, 140 },
+    { "-^__o_~?", Pattern::LiveOne, 140 },
+    { "+~___xo", Pattern::DeadOne, 30 },
+    { "+~___x?", Pattern::DeadOne, 30 },
+    { "+~___x~", Pattern::LiveOne, 150 },
+    { "-~___ox", Pattern::DeadOne, 30 },
+    { "-~___o?", Pattern::DeadOne, 30 },
+    { "-~___o~", Pattern::LiveOne, 150 },
+};
+
+}
+
+#endif // !GOMOKU_PATTERN_TABLES_H_
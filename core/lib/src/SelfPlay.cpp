@@ -0,0 +1,235 @@
+#include "SelfPlay.h"
+#include "policies/Random.h"
+#include "utils/MappedFile.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+namespace Gomoku {
+
+/* ------------------- Sample类实现 ------------------- */
+
+void Sample::EncodeStates(const Board& board, uint8_t* states) {
+    auto plane = [&](int index) { return states + index * BOARD_SIZE; };
+    int index = 0;
+    for (auto player : { board.m_curPlayer, -board.m_curPlayer, Player::None }) {
+        copy(board.moveStates(player).begin(), board.moveStates(player).end(), plane(index++));
+    }
+    for (size_t i = 0; i <= 1; ++index, ++i) {
+        fill(plane(index), plane(index) + BOARD_SIZE, 0);
+        if (board.m_moveRecord.size() > i) {
+            plane(index)[*(board.m_moveRecord.rbegin() + i)] = 1;
+        }
+    }
+    fill(plane(index), plane(index) + BOARD_SIZE, board.m_curPlayer == Player::Black);
+}
+
+Sample Sample::Encode(const Board& board, const Eigen::VectorXf& probs) {
+    Sample sample = {};
+    EncodeStates(board, sample.states.data());
+    copy(probs.data(), probs.data() + BOARD_SIZE, sample.probs.begin());
+    return sample;
+}
+
+Sample Sample::transformed(int symmetry) const {
+    Sample sample;
+    sample.value = value;
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        const int target = BoardHash::Transform(i, symmetry);
+        for (int plane = 0; plane < Planes; ++plane) {
+            sample.states[plane * BOARD_SIZE + target] = states[plane * BOARD_SIZE + i];
+        }
+        sample.probs[target] = probs[i];
+    }
+    return sample;
+}
+
+/* ------------------- ShardWriter类实现 ------------------- */
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t width;      // 棋盘边长，与样本的平面大小对应
+    uint32_t sampleSize; // sizeof(Sample)，供读取方校验布局
+    uint64_t count;
+};
+
+constexpr char ShardMagic[4] = { 'G', 'M', 'S', 'P' };
+constexpr uint32_t ShardVersion = 1;
+
+static_assert(sizeof(Header) == 24, "shard layout must not depend on padding");
+static_assert(is_trivially_copyable_v<Sample>, "samples are stored by their memory layout");
+
+ShardWriter::ShardWriter(const string& path) : m_ofs(path, ios::binary | ios::trunc) {
+    if (!m_ofs.is_open()) {
+        throw runtime_error("cannot write sample shard to " + path);
+    }
+    Header header = { {}, ShardVersion, WIDTH, sizeof(Sample), 0 };
+    memcpy(header.magic, ShardMagic, sizeof(ShardMagic));
+    m_ofs.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+}
+
+ShardWriter::~ShardWriter() {
+    if (m_ofs.is_open()) {
+        try {
+            close();
+        } catch (...) { } // 析构时无从报告，已写入的样本数以表头为准
+    }
+}
+
+void ShardWriter::write(const vector<Sample>& samples) {
+    m_ofs.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(Sample));
+    m_count += samples.size();
+    if (!m_ofs) {
+        throw runtime_error("failed to append samples to the shard");
+    }
+}
+
+void ShardWriter::close() {
+    m_ofs.seekp(offsetof(Header, count));
+    const uint64_t count = m_count;
+    m_ofs.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    m_ofs.close();
+    if (!m_ofs) {
+        throw runtime_error("failed to finalize the shard");
+    }
+}
+
+vector<Sample> ShardWriter::Read(const string& path) {
+    MappedFile file(path);
+    Header header;
+    if (file.size() < sizeof(Header)) {
+        throw runtime_error("sample shard " + path + " is truncated");
+    }
+    memcpy(&header, file.data(), sizeof(Header));
+    if (memcmp(header.magic, ShardMagic, sizeof(ShardMagic)) != 0 || header.version != ShardVersion) {
+        throw runtime_error(path + " is not a sample shard of version " + to_string(ShardVersion));
+    }
+    if (header.width != WIDTH || header.sampleSize != sizeof(Sample)) {
+        throw runtime_error("sample shard " + path + " was generated for a " + to_string(header.width) + "x" + to_string(header.width) + " board");
+    }
+    if (file.size() < sizeof(Header) + header.count * sizeof(Sample)) {
+        throw runtime_error("sample shard " + path + " is truncated");
+    }
+    vector<Sample> samples(size_t(header.count));
+    memcpy(samples.data(), file.data() + sizeof(Header), samples.size() * sizeof(Sample));
+    return samples;
+}
+
+/* ------------------- SelfPlay类实现 ------------------- */
+
+SelfPlay::SelfPlay(shared_ptr<Policy> policy, size_t c_iterations, size_t c_workers) :
+    m_policy(policy ? std::move(policy) : shared_ptr<Policy>(new Policies::RandomPolicy)),
+    c_iterations(c_iterations),
+    c_workers(c_workers) {
+    if (c_workers == 0) {
+        throw invalid_argument("self-play requires at least one worker");
+    }
+    if (c_workers > 1 && !m_policy->clone()) {
+        throw invalid_argument("parallel self-play requires a policy that supports clone()");
+    }
+}
+
+vector<Sample> SelfPlay::playGame(const shared_ptr<Policy>& policy) const {
+    Board board;
+    MCTS mcts(c_iterations, -1, Player::White, policy);
+    vector<Sample> samples;
+    vector<Player> players;
+    while (board.m_curPlayer != Player::None) {
+        Eigen::VectorXf action_probs = std::get<1>(mcts.evalState(board));
+        samples.push_back(Sample::Encode(board, action_probs));
+        players.push_back(board.m_curPlayer);
+        board.applyMove(board.getRandomMove(action_probs)); // 由MCTS在下一步搜索前同步至该手
+    }
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i].value = CalcScore(players[i], board.m_winner);
+    }
+    if (!c_augment) {
+        return samples;
+    }
+    vector<Sample> augmented;
+    augmented.reserve(samples.size() * SymmetricHash::Size);
+    for (auto& sample : samples) {
+        augmented.push_back(sample);
+        for (int s = 1; s < SymmetricHash::Size; ++s) {
+            augmented.push_back(sample.transformed(s));
+        }
+    }
+    return augmented;
+}
+
+void SelfPlay::parallelFor(size_t count, const function<void(size_t, const shared_ptr<Policy>&)>& task) const {
+    atomic<size_t> next{ 0 };
+    mutex error_mutex;
+    exception_ptr error;
+    auto work = [&](const shared_ptr<Policy>& policy) {
+        try {
+            for (size_t i; (i = next.fetch_add(1)) < count; ) {
+                task(i, policy);
+            }
+        } catch (...) {
+            lock_guard<mutex> lock(error_mutex);
+            if (!error) {
+                error = current_exception();
+            }
+            next = count; // 令其余线程完成当前任务后退出
+        }
+    };
+    if (c_workers == 1 || count <= 1) {
+        work(m_policy);
+    } else {
+        vector<thread> workers;
+        for (size_t i = 0; i < std::min(c_workers, count); ++i) {
+            workers.emplace_back(work, m_policy->clone());
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    if (error) {
+        rethrow_exception(error);
+    }
+}
+
+void SelfPlay::play(size_t games, const function<void(vector<Sample>&)>& sink) {
+    mutex sink_mutex;
+    parallelFor(games, [&](size_t, const shared_ptr<Policy>& policy) {
+        auto samples = playGame(policy);
+        lock_guard<mutex> lock(sink_mutex);
+        sink(samples);
+    });
+}
+
+vector<Sample> SelfPlay::play(size_t games) {
+    vector<Sample> samples;
+    play(games, [&](vector<Sample>& game) {
+        samples.insert(samples.end(), game.begin(), game.end());
+    });
+    return samples;
+}
+
+vector<SearchResult> SelfPlay::search(const vector<Board>& boards) const {
+    vector<SearchResult> results(boards.size());
+    parallelFor(boards.size(), [&](size_t i, const shared_ptr<Policy>& policy) {
+        Board board = boards[i];
+        if (board.m_curPlayer == Player::None) {
+            results[i] = { Position::npos, 0.0f, Eigen::VectorXf::Zero(BOARD_SIZE) };
+            return;
+        }
+        const auto last_move = board.m_moveRecord.empty() ? Position(-1) : board.m_moveRecord.back();
+        MCTS mcts(c_iterations, last_move, -board.m_curPlayer, policy);
+        auto [state_value, action_probs] = mcts.evalState(board);
+        const auto move = (mcts.m_provenMove != Position::npos ? mcts.stepForward(mcts.m_provenMove) : mcts.stepForward())->position;
+        results[i] = { move, state_value, action_probs };
+    });
+    return results;
+}
+
+}
@@ -0,0 +1,277 @@
+#include "Transposition.h"
+#include "Mapping.h"
+#include <stdexcept>
+
+using namespace std;
+
+namespace Gomoku {
+
+/* ------------------- TranspositionTable类实现 ------------------- */
+
+// 向上取整为2的幂，以便用位与代替取模
+inline size_t roundCapacity(size_t capacity) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    return size;
+}
+
+TranspositionTable::TranspositionTable(size_t capacity, bool c_symmetric)
+    : c_symmetric(c_symmetric), m_entries(new Entry[roundCapacity(capacity)]()), m_mask(roundCapacity(capacity) - 1) {
+
+}
+
+optional<Policy::EvalResult> TranspositionTable::probe(uint64_t hash) {
+    return probe(hash, 0);
+}
+
+optional<Policy::EvalResult> TranspositionTable::probe(const SymmetricHash& hash) {
+    return c_symmetric ? probe(hash.canonical(), hash.symmetry()) : probe(hash.hashes[0], 0);
+}
+
+void TranspositionTable::store(uint64_t hash, const Policy::EvalResult& result) {
+    store(hash, 0, result);
+}
+
+void TranspositionTable::store(const SymmetricHash& hash, const Policy::EvalResult& result) {
+    c_symmetric ? store(hash.canonical(), hash.symmetry(), result) : store(hash.hashes[0], 0, result);
+}
+
+optional<Policy::EvalResult> TranspositionTable::probe(uint64_t hash, int symmetry) {
+    m_probes.fetch_add(1, memory_order_relaxed);
+    auto& entry = m_entries[hash & m_mask];
+    auto sequence = entry.sequence.load(memory_order_acquire);
+    if (sequence & 1 || entry.key.load(memory_order_relaxed) != hash) {
+        return nullopt;
+    }
+    Eigen::VectorXf probs(BOARD_SIZE);
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        probs[i] = entry.probs[BoardHash::Transform(i, symmetry)].load(memory_order_relaxed);
+    }
+    float value = entry.value.load(memory_order_relaxed);
+    atomic_thread_fence(memory_order_acquire);
+    if (entry.sequence.load(memory_order_relaxed) != sequence) { // 读取期间被其他线程改写
+        return nullopt;
+    }
+    m_hits.fetch_add(1, memory_order_relaxed);
+    return Policy::EvalResult{ value, std::move(probs) };
+}
+
+void TranspositionTable::store(uint64_t hash, int symmetry, const Policy::EvalResult& result) {
+    auto& entry = m_entries[hash & m_mask];
+    auto sequence = entry.sequence.load(memory_order_relaxed);
+    if (sequence & 1 || !entry.sequence.compare_exchange_strong(sequence, sequence + 1, memory_order_acquire)) {
+        return; // 其他线程正在写入该表项
+    }
+    atomic_thread_fence(memory_order_release);
+    auto& [value, probs] = result;
+    if (auto key = entry.key.load(memory_order_relaxed); key != hash && key != 0) {
+        m_overwrites.fetch_add(1, memory_order_relaxed);
+    }
+    entry.key.store(hash, memory_order_relaxed);
+    entry.value.store(value, memory_order_relaxed);
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        entry.probs[BoardHash::Transform(i, symmetry)].store(probs[i], memory_order_relaxed);
+    }
+    entry.sequence.store(sequence + 2, memory_order_release);
+    m_stores.fetch_add(1, memory_order_relaxed);
+}
+
+void TranspositionTable::clear() {
+    // 与写入相同地递增序号，使并发的读取不会接受清空了一半的表项
+    for (size_t i = 0; i <= m_mask; ++i) {
+        auto& entry = m_entries[i];
+        auto sequence = entry.sequence.load(memory_order_relaxed);
+        if (sequence & 1 || !entry.sequence.compare_exchange_strong(sequence, sequence + 1, memory_order_acquire)) {
+            continue; // 其他线程正在写入该表项，写入的结果晚于清空
+        }
+        atomic_thread_fence(memory_order_release);
+        entry.key.store(0, memory_order_relaxed);
+        entry.sequence.store(sequence + 2, memory_order_release);
+    }
+    m_probes = m_hits = m_stores = m_overwrites = 0;
+}
+
+TranspositionTable::Stats TranspositionTable::stats() const {
+    return { m_probes.load(), m_hits.load(), m_stores.load(), m_overwrites.load() };
+}
+
+double TranspositionTable::hitRate() const {
+    auto probes = m_probes.load();
+    return probes ? double(m_hits.load()) / probes : 0.0;
+}
+
+uint64_t TranspositionTable::Hash(const Board& board) {
+    uint64_t hash = 0;
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        auto player = board.moveState(Player::Black, i) ? Player::Black
+                    : board.moveState(Player::White, i) ? Player::White : Player::None;
+        hash ^= BoardHash::HashPose(i, player);
+    }
+    return hash;
+}
+
+uint64_t TranspositionTable::HashMove(uint64_t hash, Position move, Player player) {
+    return hash ^ BoardHash::HashPose(move, Player::None) ^ BoardHash::HashPose(move, player);
+}
+
+/* ------------------- EvaluationCache类实现 ------------------- */
+
+EvaluationCache::EvaluationCache(size_t c_memory, bool c_symmetric, size_t c_shards)
+    : c_memory(c_memory), c_symmetric(c_symmetric), m_shards(c_shards) {
+    if (c_shards == 0) {
+        throw invalid_argument("evaluation cache requires at least one shard");
+    }
+}
+
+size_t EvaluationCache::EntrySize(size_t entries) {
+    // 链表结点含前后指针，索引结点含键、迭代器、链指针与桶指针
+    return sizeof(Entry) + 2 * sizeof(void*) + entries * sizeof(Policy::SparseProbs::value_type)
+         + sizeof(uint64_t) + 3 * sizeof(void*);
+}
+
+pair<uint64_t, int> EvaluationCache::key(const Board& board) const {
+    const SymmetricHash hash(board);
+    const auto symmetry = c_symmetric ? hash.symmetry() : 0;
+    const auto& record = board.m_moveRecord;
+    auto recent = [&](size_t back) { // 倒数第back手在规范变换下的位置加1，不存在时为0
+        return record.size() < back ? 0 : BoardHash::Transform(record[record.size() - back], symmetry) + 1;
+    };
+    uint64_t state = uint64_t(recent(1)) | uint64_t(recent(2)) << 16;
+    return { (c_symmetric ? hash.canonical() : hash.hashes[0]) ^ SplitMix64(state), symmetry };
+}
+
+optional<Policy::EvalResult> EvaluationCache::probe(const Board& board) {
+    m_probes.fetch_add(1, memory_order_relaxed);
+    const auto [key, symmetry] = this->key(board);
+    auto& shard = this->shard(key);
+    Eigen::VectorXf probs = Eigen::VectorXf::Zero(BOARD_SIZE);
+    float value;
+    {
+        lock_guard<mutex> lock(shard.mutex);
+        auto iter = shard.index.find(key);
+        if (iter == shard.index.end()) {
+            return nullopt;
+        }
+        shard.entries.splice(shard.entries.begin(), shard.entries, iter->second);
+        value = iter->second->value;
+        for (auto [pose, prob] : iter->second->priors) {
+            probs[BoardHash::Transform(pose, BoardHash::Inverse(symmetry))] = prob;
+        }
+    }
+    m_hits.fetch_add(1, memory_order_relaxed);
+    return Policy::EvalResult{ value, std::move(probs) };
+}
+
+void EvaluationCache::store(const Board& board, const Policy::EvalResult& result) {
+    const auto [key, symmetry] = this->key(board);
+    auto& [value, probs] = result;
+    Policy::SparseProbs priors;
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        if (probs[i] != 0) {
+            priors.emplace_back(BoardHash::Transform(i, symmetry), probs[i]);
+        }
+    }
+    priors.shrink_to_fit();
+    Entry entry = { key, value, std::move(priors) };
+    const auto size = EntrySize(entry.priors.size());
+    auto& shard = this->shard(key);
+    const auto capacity = c_memory / m_shards.size();
+    if (size > capacity) {
+        return;
+    }
+    lock_guard<mutex> lock(shard.mutex);
+    if (auto iter = shard.index.find(key); iter != shard.index.end()) {
+        shard.memory -= EntrySize(iter->second->priors.size());
+        shard.entries.erase(iter->second);
+        shard.index.erase(iter);
+    }
+    while (shard.memory + size > capacity) {
+        auto& last = shard.entries.back();
+        shard.memory -= EntrySize(last.priors.size());
+        shard.index.erase(last.key);
+        shard.entries.pop_back();
+        m_evictions.fetch_add(1, memory_order_relaxed);
+    }
+    shard.entries.push_front(std::move(entry));
+    shard.index.emplace(key, shard.entries.begin());
+    shard.memory += size;
+    m_stores.fetch_add(1, memory_order_relaxed);
+}
+
+void EvaluationCache::clear() {
+    for (auto& shard : m_shards) {
+        lock_guard<mutex> lock(shard.mutex);
+        shard.entries.clear();
+        shard.index.clear();
+        shard.memory = 0;
+    }
+    m_probes = m_hits = m_stores = m_evictions = 0;
+}
+
+EvaluationCache::Stats EvaluationCache::stats() const {
+    return { m_probes.load(), m_hits.load(), m_stores.load(), m_evictions.load() };
+}
+
+double EvaluationCache::hitRate() const {
+    auto probes = m_probes.load();
+    return probes ? double(m_hits.load()) / probes : 0.0;
+}
+
+size_t EvaluationCache::size() const {
+    size_t size = 0;
+    for (auto& shard : m_shards) {
+        lock_guard<mutex> lock(shard.mutex);
+        size += shard.index.size();
+    }
+    return size;
+}
+
+size_t EvaluationCache::memory() const {
+    size_t memory = 0;
+    for (auto& shard : m_shards) {
+        lock_guard<mutex> lock(shard.mutex);
+        memory += shard.memory;
+    }
+    return memory;
+}
+
+Policy::EvalFunc EvaluationCache::Cached(shared_ptr<EvaluationCache> cache, Policy::EvalFunc evaluate) {
+    return [cache, evaluate](Board& board) {
+        if (auto result = cache->probe(board)) {
+            return std::move(*result);
+        }
+        auto result = evaluate(board);
+        cache->store(board, result);
+        return result;
+    };
+}
+
+Policy::BatchEvalFunc EvaluationCache::Cached(shared_ptr<EvaluationCache> cache, Policy::BatchEvalFunc evaluate) {
+    return [cache, evaluate](const vector<Board>& boards) {
+        vector<optional<Policy::EvalResult>> cached;
+        vector<Board> misses;
+        cached.reserve(boards.size());
+        for (auto& board : boards) {
+            cached.push_back(cache->probe(board));
+            if (!cached.back()) {
+                misses.push_back(board);
+            }
+        }
+        auto evaluated = misses.empty() ? vector<Policy::EvalResult>() : evaluate(misses);
+        vector<Policy::EvalResult> results;
+        results.reserve(boards.size());
+        for (size_t i = 0, j = 0; i < boards.size(); ++i) {
+            if (cached[i]) {
+                results.push_back(std::move(*cached[i]));
+            } else {
+                cache->store(boards[i], evaluated[j]);
+                results.push_back(evaluated[j++]);
+            }
+        }
+        return results;
+    };
+}
+
+}
@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <numeric>
 #include <queue>
+#include <stdexcept>
 
 using namespace std;
 
@@ -20,27 +21,34 @@ void AhoCorasickBuilder::build(PatternSearch* searcher) {
     this->buildNodeBasedTrie();
     this->buildDAT(searcher);
     this->buildACGraph(searcher);
+    this->buildLookupTable(searcher);
+}
+
+Pattern AhoCorasickBuilder::derive(const Pattern& proto, string str) {
+    Pattern derived(proto);
+    derived.str = m_strings.emplace_back(std::move(str));
+    return derived;
 }
 
 void AhoCorasickBuilder::reverseAugment() {
     for (int i = 0, size = m_patterns.size(); i < size; ++i) {
-        Pattern reversed(m_patterns[i]);
-        std::reverse(reversed.str.begin(), reversed.str.end());
-        if (reversed.str != m_patterns[i].str) {
-            m_patterns.push_back(std::move(reversed));
+        string reversed(m_patterns[i].str.rbegin(), m_patterns[i].str.rend());
+        if (reversed != m_patterns[i].str) {
+            m_patterns.push_back(derive(m_patterns[i], std::move(reversed)));
         }
     }
 }
 
 void AhoCorasickBuilder::flipAugment() {
     for (int i = 0, size = m_patterns.size(); i < size; ++i) {
-        Pattern flipped(m_patterns[i]);
-        flipped.favour = -flipped.favour;
-        for (auto& piece : flipped.str) {
+        string str(m_patterns[i].str);
+        for (auto& piece : str) {
             if (piece == 'x') piece = 'o';
             else if (piece == 'o') piece = 'x';
         }
-        m_patterns.push_back(std::move(flipped));
+        Pattern flipped = derive(m_patterns[i], std::move(str));
+        flipped.favour = -flipped.favour;
+        m_patterns.push_back(flipped);
     }
 }
 
@@ -50,14 +58,14 @@ void AhoCorasickBuilder::boundaryAugment() {
         auto first = m_patterns[i].str.find_first_of(enemy);
         auto last = m_patterns[i].str.find_last_of(enemy);
         if (first != string::npos) { // 最多只有三种情况
-            Pattern bounded(m_patterns[i]);
-            bounded.str[first] = '?';
-            m_patterns.push_back(bounded);
+            string bounded(m_patterns[i].str);
+            bounded[first] = '?';
+            m_patterns.push_back(derive(m_patterns[i], bounded));
             if (last != first) {
-                bounded.str[last] = '?';
-                m_patterns.push_back(bounded);
-                bounded.str[first] = enemy;
-                m_patterns.push_back(std::move(bounded));
+                bounded[last] = '?';
+                m_patterns.push_back(derive(m_patterns[i], bounded));
+                bounded[first] = enemy;
+                m_patterns.push_back(derive(m_patterns[i], bounded));
             }
         }
     }
@@ -70,10 +78,11 @@ void AhoCorasickBuilder::sortPatterns() {
 
     // 编码、填充与排序
     std::transform(m_patterns.begin(), m_patterns.end(), codes.begin(), [](const Pattern& p) {
-        auto align_offset = std::pow(std::size(Codeset), MAX_PATTERN_LEN - p.str.size());
+        constexpr int radix = std::size(Codeset) + 1; // 编码从1开始，0留给对齐时补齐的空位
+        auto align_offset = std::pow(radix, MAX_PATTERN_LEN - p.str.size());
         return std::accumulate(p.str.begin(), p.str.end(), 0, [&](int sum, char ch) {
-            return sum *= std::size(Codeset), sum += EncodeCharset(ch);
-        }) * align_offset; // 按size(Codeset)进制记数并对齐
+            return sum *= radix, sum += EncodeCharset(ch);
+        }) * align_offset; // 按radix进制记数并对齐
     }); // 通过对齐的基数排序间接实现字典序排序
     std::iota(indices.begin(), indices.end(), 0);
     std::sort(indices.begin(), indices.end(), [&codes](int lhs, int rhs) {
@@ -156,12 +165,13 @@ void AhoCorasickBuilder::buildNodeBasedTrie() {
     因此也不会产生冲突。
 */
 void AhoCorasickBuilder::buildDAT(PatternSearch* ps) {
+    auto& st = storage(ps);
     // index为node在双数组中的索引，之前的递归中已确定好
     function<void(int, NodeIter)> build_recursive = [&](int index, NodeIter node) {
         if (node->depth > 0 && node->code == 0) {
             // Base case: 已抵达叶结点，设置index的base为(-对应pattern表的下标)
             // 此时node的last - first == 1, [first, last)唯一确定了一个结点
-            ps->m_base[index] = -node->first; 
+            st.base[index] = -node->first; 
         } else {
             // 准备数据
             auto [first, last] = children(node);
@@ -174,7 +184,7 @@ void AhoCorasickBuilder::buildDAT(PatternSearch* ps) {
                 参考：http://www.aclweb.org/anthology/D13-1023
             */
             do {
-                front = -ps->m_check[front]; // 首个子结点的下标
+                front = -st.check[front]; // 首个子结点的下标
                 begin = front - first->code; // 子结点的偏移基准值
 
                 // 由于负的base值有特殊语义，begin值必须大于0。
@@ -182,15 +192,15 @@ void AhoCorasickBuilder::buildDAT(PatternSearch* ps) {
 
                 // 空间不足时扩充m_base与m_check数组。
                 // 阈值设为size - 1以保证最后一位为空（下式1移到了左侧以防止溢出）
-                while (begin + std::size(Codeset) + 1 >= ps->m_check.size()) {
+                while (begin + std::size(Codeset) + 1 >= st.check.size()) {
                     // 扩充空间
-                    auto pre_size = ps->m_base.size();
-                    ps->m_base.resize(2 * pre_size);
-                    ps->m_check.resize(2 * pre_size);
+                    auto pre_size = st.base.size();
+                    st.base.resize(2 * pre_size);
+                    st.check.resize(2 * pre_size);
                     // 填充下标补全双链表
-                    for (int i = pre_size; i < ps->m_base.size(); ++i) {
-                        ps->m_base[i] = -(i - 1); // 逆向链表
-                        ps->m_check[i] = -(i + 1); // 前向链表
+                    for (size_t i = pre_size; i < st.base.size(); ++i) {
+                        st.base[i] = -int(i - 1); // 逆向链表
+                        st.check[i] = -int(i + 1); // 前向链表
                     }
                 }
 
@@ -198,7 +208,7 @@ void AhoCorasickBuilder::buildDAT(PatternSearch* ps) {
             // 筛选条件：根节点/check值不小于0的结点是被占用的。
             } while (!std::all_of(first, last, [&](const Node& node) {
                 auto c_i = begin + node.code;
-                return c_i != 0 && ps->m_check[c_i] < 0;
+                return c_i != 0 && st.check[c_i] < 0;
             }));
 
             // 遍历子结点，设置相关状态后对子结点递归构建
@@ -207,31 +217,34 @@ void AhoCorasickBuilder::buildDAT(PatternSearch* ps) {
                 int c_i = begin + cur->code;
 
                 // 将当前下标移出空闲节点链表（利用Dancing Links）
-                ps->m_check[-ps->m_base[c_i]] = ps->m_check[c_i];
-                ps->m_base[-ps->m_check[c_i]] = ps->m_base[c_i];
+                st.check[-st.base[c_i]] = st.check[c_i];
+                st.base[-st.check[c_i]] = st.base[c_i];
 
                 // 将子结点check值与父结点绑定
-                ps->m_check[c_i] = index;
+                st.check[c_i] = index;
             }
             // 父结点的base设置为找好的begin值
-            ps->m_base[index] = begin; 
+            st.base[index] = begin; 
             // Recursive Step: 对每个子结点递归构造
             for (auto cur = first; cur != last; ++cur) {
                 build_recursive(begin + cur->code, cur);
             }
         }
     };
-    ps->m_base.resize(1, 0);   // 根节点(0)没有前驱结点，故其base位不为逆向链表的标记点，而用作本义base值。
-    ps->m_check.resize(1, -1); // 根节点(0)由于没有父结点，故其无本义check值，该位置用来作为前向链表的起点。
+    st.base.resize(1, 0);   // 根节点(0)没有前驱结点，故其base位不为逆向链表的标记点，而用作本义base值。
+    st.check.resize(1, -1); // 根节点(0)由于没有父结点，故其无本义check值，该位置用来作为前向链表的起点。
     auto root = m_tree.find({});
     build_recursive(0, root);
-    ps->m_patterns.swap(m_patterns);
+    st.patterns.swap(m_patterns);
+    st.strings.swap(m_strings);
+    publish(ps);
 }
 
 void AhoCorasickBuilder::buildACGraph(PatternSearch* ps) {
+    auto& st = storage(ps);
     // 初始，所有结点的fail指针都指向根节点
-    ps->m_fail.resize(ps->m_base.size(), 0);
-    ps->m_invariants.resize(std::size(Codeset) + 1, 0);
+    st.fail.resize(st.base.size(), 0);
+    st.invariants.resize(std::size(Codeset) + 1, 0);
 
     // 准备好结点队列，置入根节点作为初始值
     queue<int> node_queue;
@@ -243,8 +256,8 @@ void AhoCorasickBuilder::buildACGraph(PatternSearch* ps) {
 
         // 准备新的结点
         for (auto code : Codeset) {
-            int child_node = ps->m_base[cur_node] + code;
-            if (ps->m_check[child_node] == cur_node) {
+            int child_node = st.base[cur_node] + code;
+            if (st.check[child_node] == cur_node) {
                 node_queue.push(child_node);
             }
         }
@@ -253,24 +266,110 @@ void AhoCorasickBuilder::buildACGraph(PatternSearch* ps) {
         if (cur_node == 0) continue;
 
         // 为当前结点设置fail指针
-        int code = cur_node - ps->m_base[ps->m_check[cur_node]]; // 取得转换至cur结点的编码
-        int pre_fail_node = ps->m_check[cur_node]; // 初始pre_fail结点设置为cur结点的父结点
+        int code = cur_node - st.base[st.check[cur_node]]; // 取得转换至cur结点的编码
+        int pre_fail_node = st.check[cur_node]; // 初始pre_fail结点设置为cur结点的父结点
         while (pre_fail_node != 0) { // 按匹配后缀长度从长->短不断跳转fail结点，直到长度为0（抵达根节点）
             // 每一次fail指针的跳转，最大匹配后缀的长度至少减少了1，因此循环是有限的
-            pre_fail_node = ps->m_fail[pre_fail_node];
-            int fail_node = ps->m_base[pre_fail_node] + code;
-            if (ps->m_check[fail_node] == pre_fail_node) { // 如若pre_fail结点能通过code抵达某子结点（即fail_node存在）
-                ps->m_fail[cur_node] = fail_node; // 则该子结点即为cur结点的fail指针的指向
+            pre_fail_node = st.fail[pre_fail_node];
+            int fail_node = st.base[pre_fail_node] + code;
+            if (st.check[fail_node] == pre_fail_node) { // 如若pre_fail结点能通过code抵达某子结点（即fail_node存在）
+                st.fail[cur_node] = fail_node; // 则该子结点即为cur结点的fail指针的指向
                 break;
             }
             // 若直到pre_fail结点为0才退出，则当前结点的fail指针指向根节点。
         }
         // 若某结点接受code后转移至自己，则该节点为「不动点状态」
-        if (ps->m_check[ps->m_base[cur_node] + code] != cur_node &&
-            ps->m_base[ps->m_fail[cur_node]] + code == cur_node) { 
-            ps->m_invariants[code] = cur_node;
+        if (st.check[st.base[cur_node] + code] != cur_node &&
+            st.base[st.fail[cur_node]] + code == cur_node) { 
+            st.invariants[code] = cur_node;
+        }
+    }
+    publish(ps);
+}
+
+/*
+    查找表以窗口编码为索引。窗口是MAX_PATTERN_LEN个连续棋位，从前往后每位依次压入2比特（编码减1）。
+    长为len的模式与窗口的末len位相同时，即称该模式以窗口末位结尾，此时窗口的前MAX_PATTERN_LEN - len位可任取。
+    因此只需对每个模式枚举这些前缀，而无须对每个窗口逐一比对所有模式。
+*/
+void AhoCorasickBuilder::buildLookupTable(PatternSearch* ps) {
+    static_assert(std::size(Codeset) == 4, "each code must fit in 2 bits");
+    auto& st = storage(ps);
+    const auto& patterns = st.patterns;
+    vector<vector<int>> buckets(1 << PatternSearch::WindowBits);
+    for (size_t index = 0; index < patterns.size(); ++index) {
+        const auto& str = patterns[index].str;
+        const int suffix_bits = 2 * str.length();
+        unsigned suffix = 0;
+        for (char ch : str) {
+            suffix = (suffix << 2) | (EncodeCharset(ch) - 1);
+        }
+        for (unsigned prefix = 0; prefix < (1u << (PatternSearch::WindowBits - suffix_bits)); ++prefix) {
+            buckets[(prefix << suffix_bits) | suffix].push_back(int(index));
+        }
+    }
+    st.windowFirst.assign(1, 0);
+    st.windowPatterns.clear();
+    for (auto& bucket : buckets) {
+        if (bucket.size() > PatternSearch::MaxWindowMatches) {
+            throw length_error("too many patterns end at the same window");
         }
+        // 同一结尾处的模式按长度降序排列，与AC自动机先匹配长模式、再经fail指针匹配其后缀的顺序一致
+        std::stable_sort(bucket.begin(), bucket.end(), [&](int lhs, int rhs) {
+            return patterns[lhs].str.length() > patterns[rhs].str.length();
+        });
+        st.windowPatterns.insert(st.windowPatterns.end(), bucket.begin(), bucket.end());
+        st.windowFirst.push_back(st.windowPatterns.size());
+    }
+    publish(ps);
+}
+
+PatternSearch::Storage& AhoCorasickBuilder::storage(PatternSearch* ps) {
+    if (!ps->m_storage) {
+        ps->m_storage = make_unique<PatternSearch::Storage>();
+    }
+    return *ps->m_storage;
+}
+
+void AhoCorasickBuilder::publish(PatternSearch* ps) {
+    auto& st = storage(ps);
+    ps->m_base = st.base.data(), ps->m_check = st.check.data();
+    ps->m_fail = st.fail.data(), ps->m_invariants = st.invariants.data();
+    ps->m_patterns = st.patterns.data();
+    ps->m_windowFirst = st.windowFirst.data(), ps->m_windowPatterns = st.windowPatterns.data();
+}
+
+void AhoCorasickBuilder::Emit(const PatternSearch& searcher, ostream& os) {
+    if (!searcher.m_storage) {
+        throw invalid_argument("only searchers built at runtime can be emitted");
+    }
+    const auto& st = *searcher.m_storage;
+    const auto emit_array = [&](const char* name, const vector<int>& values) {
+        os << "constexpr int " << name << "[] = {";
+        for (size_t i = 0; i < values.size(); ++i) {
+            os << (i % 16 == 0 ? "\n    " : " ") << values[i] << ',';
+        }
+        os << "\n};\n\n";
+    };
+    os << "// 由AhoCorasickBuilder::Emit根据Evaluator::Prototypes生成，请勿手动修改。\n"
+       << "// 修改模式原型或构建过程后，运行PatternSearchTest.GeneratedTables，以其输出的文件替换本文件。\n"
+       << "#ifndef GOMOKU_PATTERN_TABLES_H_\n#define GOMOKU_PATTERN_TABLES_H_\n#include \"Pattern.h\"\n\n"
+       << "namespace Gomoku::PatternTables {\n\n";
+    emit_array("Base", st.base);
+    emit_array("Check", st.check);
+    emit_array("Fail", st.fail);
+    emit_array("Invariants", st.invariants);
+    emit_array("WindowFirst", st.windowFirst);
+    emit_array("WindowPatterns", st.windowPatterns);
+    static constexpr const char* types[] = {
+        "DeadOne", "LiveOne", "DeadTwo", "LiveTwo", "DeadThree", "LiveThree", "DeadFour", "LiveFour", "Five"
+    };
+    os << "constexpr Pattern Patterns[] = {\n";
+    for (const auto& pattern : st.patterns) {
+        os << "    { \"" << (pattern.favour == Player::Black ? '+' : '-') << pattern.str << "\", Pattern::"
+           << types[pattern.type] << ", " << pattern.score << " },\n";
     }
+    os << "};\n\n}\n\n#endif // !GOMOKU_PATTERN_TABLES_H_\n";
 }
 
 }
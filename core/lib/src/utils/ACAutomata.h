@@ -1,7 +1,10 @@
 #ifndef GOMOKU_AHO_CORASICK_H_
 #define GOMOKU_AHO_CORASICK_H_
 #include "../include/Pattern.h"
+#include <deque>
+#include <ostream>
 #include <set>
+#include <string>
 
 namespace Gomoku {
 
@@ -35,6 +38,9 @@ public:
 
     void build(PatternSearch* searcher);
 
+    // 将构建好的搜索器输出为C++源码（lib/src/PatternTables.h），供Evaluator::Patterns在编译期引用
+    static void Emit(const PatternSearch& searcher, std::ostream& os);
+
 public:
     // 不对称的pattern反过来看与原pattern等价
     void reverseAugment();
@@ -57,7 +63,19 @@ public:
     // BFS遍历，为DAT构建AC自动机的fail指针数组
     void buildACGraph(PatternSearch* ps);
 
+    // 枚举所有窗口，为每个窗口记录以其末位结尾的模式，构建查找表
+    void buildLookupTable(PatternSearch* ps);
+
 private:
+    // 以proto为原型、str为模式串派生新模式，str由m_strings持有
+    Pattern derive(const Pattern& proto, std::string str);
+
+    // 取得ps的动态存储，不存在时创建
+    static PatternSearch::Storage& storage(PatternSearch* ps);
+
+    // 令ps的各数组指向其动态存储，每一阶段构建完成后调用
+    static void publish(PatternSearch* ps);
+
     std::pair<NodeIter, NodeIter> children(NodeIter node) {
         auto first = m_tree.lower_bound({ 0, node->depth + 1, node->first }); // 子节点下界（no less than）
         auto last = m_tree.upper_bound({ 0, node->depth + 1, node->last - 1 }); // 子节点上界（greater than）
@@ -67,6 +85,7 @@ private:
 private:
     std::set<Node> m_tree; // 利用在插入中保持有序的RB树，作为临时保存Trie树的结构
     std::vector<Pattern> m_patterns;
+    std::deque<std::string> m_strings; // 增强所得的模式串，构建DAT时连同m_patterns转交搜索器
 };
 
 }
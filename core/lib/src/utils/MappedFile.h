@@ -0,0 +1,33 @@
+#ifndef GOMOKU_MAPPED_FILE_H_
+#define GOMOKU_MAPPED_FILE_H_
+#include <cstddef>
+#include <string>
+
+namespace Gomoku {
+
+// 以只读方式映射至内存的文件，内容随用随从页缓存载入，多个进程映射同一文件时共享物理内存
+class MappedFile {
+public:
+    // 文件不存在或无法映射时抛出std::runtime_error
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+private:
+    const char* m_data = nullptr; // 空文件不映射，保持为空
+    std::size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+
+}
+
+#endif // !GOMOKU_MAPPED_FILE_H_
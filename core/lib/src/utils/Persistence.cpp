@@ -1,46 +1,171 @@
 #include "Persistence.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 using namespace std;
 using namespace Gomoku;
 
-// עdataļһҪȴڣ
-constexpr auto data_path = L"./data/persistence.json";
+namespace {
+
+struct Header {
+	char magic[4];
+	uint32_t version;
+	uint64_t count;
+};
+
+// Ŀ¼ֵļеλ
+struct Record {
+	uint64_t nameOffset, nameSize;
+	uint64_t valueOffset, valueSize;
+};
+
+constexpr char StoreMagic[4] = { 'G', 'M', 'K', 'V' };
+constexpr uint32_t StoreVersion = 1;
+
+inline uint64_t align(uint64_t offset) {
+	return (offset + 7) & ~uint64_t(7);
+}
 
 struct Handle {
-	// ڴ
-	json data;
+	mutex lock;
+	string path = Persistence::DefaultPath;
+	bool opened = false;
+	unique_ptr<MappedFile> file; // ļʱΪ
+	const Record* records = nullptr;
+	size_t count = 0;
 
 	static Handle& Inst() {
 		static Handle handle;
 		return handle;
 	}
 
-	Handle() {
-		ifstream ifs(data_path);
-		if (ifs.is_open()) {
-			ifs >> data;
-		}
+	string_view name(const Record& record) const {
+		return { file->data() + record.nameOffset, size_t(record.nameSize) };
 	}
 
-	~Handle() {
-		ofstream ofs(data_path);
-		if (!ofs.is_open()) {
-			throw data_path; // filesystem...botzoneϴܲ
+	string_view value(const Record& record) const {
+		return { file->data() + record.valueOffset, size_t(record.valueSize) };
+	}
+
+	// ״ηʱӳļУĿ¼
+	void open() {
+		if (opened) {
+			return;
+		}
+		opened = true;
+		if (!ifstream(path).is_open()) {
+			return;
+		}
+		file = make_unique<MappedFile>(path);
+		Header header;
+		bool valid = file->size() >= sizeof(Header);
+		if (valid) {
+			copy_n(file->data(), sizeof(Header), reinterpret_cast<char*>(&header));
+			valid = equal(begin(StoreMagic), end(StoreMagic), header.magic) && header.version == StoreVersion
+				&& header.count <= (file->size() - sizeof(Header)) / sizeof(Record);
 		}
-		ofs << data;
+		for (uint64_t i = 0; valid && i < header.count; ++i) {
+			const auto records = reinterpret_cast<const Record*>(file->data() + sizeof(Header));
+			auto& record = records[i];
+			valid = record.nameOffset <= file->size() && record.nameSize <= file->size() - record.nameOffset
+				&& record.valueOffset <= file->size() && record.valueSize <= file->size() - record.valueOffset;
+		}
+		if (!valid) {
+			file.reset();
+			throw runtime_error(path + " is not a valid persistence store");
+		}
+		records = reinterpret_cast<const Record*>(file->data() + sizeof(Header));
+		count = size_t(header.count);
+	}
+
+	// ͷӳ䣬һηʱ´
+	void close() {
+		file.reset();
+		records = nullptr;
+		count = 0;
+		opened = false;
 	}
 };
 
-json Gomoku::Persistence::Load(std::string_view name) {
-	if (Handle::Inst().data.count(name.data())) {
-		return Handle::Inst().data[name.data()];
-	} else {
-		return json();
+}
+
+string Gomoku::Persistence::Path() {
+	auto& handle = Handle::Inst();
+	lock_guard<mutex> guard(handle.lock);
+	return handle.path;
+}
+
+void Gomoku::Persistence::SetPath(string path) {
+	auto& handle = Handle::Inst();
+	lock_guard<mutex> guard(handle.lock);
+	handle.close();
+	handle.path = std::move(path);
+}
+
+string_view Gomoku::Persistence::Load(string_view name) {
+	auto& handle = Handle::Inst();
+	lock_guard<mutex> guard(handle.lock);
+	handle.open();
+	const auto last = handle.records + handle.count;
+	auto record = lower_bound(handle.records, last, name, [&](const Record& entry, string_view key) {
+		return handle.name(entry) < key;
+	});
+	if (record == last || handle.name(*record) != name) {
+		return {};
 	}
+	return handle.value(*record);
 }
 
-void Gomoku::Persistence::Save(std::string_view name, json value) {
-	Handle::Inst().data[name.data()] = std::move(value);
+void Gomoku::Persistence::Save(string_view name, string_view value) {
+	auto& handle = Handle::Inst();
+	lock_guard<mutex> guard(handle.lock);
+	handle.open();
+	map<string, string, less<>> entries;
+	for (size_t i = 0; i < handle.count; ++i) {
+		entries.emplace(handle.name(handle.records[i]), handle.value(handle.records[i]));
+	}
+	entries[string(name)] = string(value);
+	handle.close(); // Windows޷дԱӳļ
+
+	// ŲĿ¼ֵֵʼλð8ֽڶ
+	vector<Record> records;
+	uint64_t offset = sizeof(Header) + entries.size() * sizeof(Record);
+	for (auto& [key, _] : entries) {
+		records.push_back({ offset, key.size(), 0, 0 });
+		offset += key.size();
+	}
+	size_t i = 0;
+	for (auto& [_, data] : entries) {
+		offset = align(offset);
+		records[i].valueOffset = offset, records[i].valueSize = data.size();
+		offset += data.size(), ++i;
+	}
+	ofstream ofs(handle.path, ios::binary | ios::trunc);
+	if (!ofs.is_open()) {
+		throw runtime_error("cannot write " + handle.path);
+	}
+	Header header = { { StoreMagic[0], StoreMagic[1], StoreMagic[2], StoreMagic[3] }, StoreVersion, entries.size() };
+	ofs.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+	ofs.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+	for (auto& [key, _] : entries) {
+		ofs.write(key.data(), key.size());
+	}
+	i = 0;
+	for (auto& [_, data] : entries) {
+		const string padding(records[i].valueOffset - uint64_t(ofs.tellp()), '\0');
+		ofs.write(padding.data(), padding.size());
+		ofs.write(data.data(), data.size());
+		++i;
+	}
+	if (!ofs) {
+		throw runtime_error("cannot write " + handle.path);
+	}
 }
@@ -1,14 +1,30 @@
 #ifndef GOMOKU_PERSISTENCE_H_
 #define GOMOKU_PERSISTENCE_H_
-#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
 
 namespace Gomoku {
 
-	using json = nlohmann::json;
-
+	/*
+		Ƽֵ洢ڿֿ⡢ͱȽϴݡ
+		 ļɱͷĶĿ¼ֵԭʼֽڣ8ֽڶ룩ɡ
+		 ״LoadʱڴӳļʱΪմ洢ֵ뿽ֱָӳֽڡ
+		 ֻSaveʱдļ
+	*/
 	struct Persistence {
-		static json Load(std::string_view name);
-		static void Save(std::string_view name, json value);
+		static constexpr const char* DefaultPath = "./data/persistence.bin";
+
+		// 洢ļ·ĬΪDefaultPath
+		static std::string Path();
+
+		// pathĴ洢ļѴ򿪵ӳ֮رգǰLoadصͼһʧЧ
+		static void SetPath(std::string path);
+
+		// Ϊnameֵ޴ʱΪաصͼһSave֮ǰЧ
+		static std::string_view Load(std::string_view name);
+
+		// дΪnameֵдļʱʹáļ޷дʱ׳std::runtime_error
+		static void Save(std::string_view name, std::string_view value);
 	};
 
 }
@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "lib/include/Game.h"
+#include "lib/include/SelfPlay.h"
+#include "numpy_ext.hpp"
 
 inline void Game_Ext(py::module& mod) {
     // Import the `_a` literal
@@ -45,6 +47,7 @@ inline void Game_Ext(py::module& mod) {
             auto dict = py::dict("x"_a = p.x(), "y"_a = p.y()); // READ-ONLY ITERATOR
             return py::make_iterator(dict.begin(), dict.end(), py::return_value_policy::copy); // ATTENTION: potential early-stop bug when work with iter()
         });
+    py::implicitly_convertible<int, Position>(); // Plain ids are accepted wherever a Position is expected
         
 
 
@@ -68,11 +71,13 @@ inline void Game_Ext(py::module& mod) {
             }
             return move_counts;
         })
-        .def_property_readonly("move_states", [](const Board& b) {
+        .def_property_readonly("move_states", [](py::object self) {
+            const auto& b = self.cast<const Board&>();
             py::dict move_states;
             for (auto player : { Player::Black, Player::None, Player::White }) {
-                // reshape to a square board
-                move_states[py::cast(player)] = py::array(py::dtype("uint8"), { HEIGHT, WIDTH }, b.moveStates(player).data()); 
+                // Read-only square views into the board, following its later moves
+                auto states = reinterpret_cast<const std::uint8_t*>(b.moveStates(player).data());
+                move_states[py::cast(player)] = ReadonlyView<std::uint8_t>({ HEIGHT, WIDTH }, states, self);
             }
             return move_states;
         })
@@ -85,23 +90,17 @@ inline void Game_Ext(py::module& mod) {
             );
         })
         .def("encoded_states", [](const Board& b) {
-            py::array_t<unsigned char> states({ 6, (int)HEIGHT, (int)WIDTH }); // 先y再x
-
-            int index = 0;  // index将在流式初始化过程中自增
-            for (auto player : { b.m_curPlayer, -b.m_curPlayer, Player::None }) {
-                std::copy(b.moveStates(player).begin(), b.moveStates(player).end(), states.mutable_data(index++));
-            }
-            for (int i = 0; i <= 1; ++index, ++i) {
-                std::fill(states.mutable_data(index), states.mutable_data(index) + HEIGHT * WIDTH, 0);
-                if (b.m_moveRecord.size() > i) {
-                    auto position = *(b.m_moveRecord.rbegin() + i);
-                    *states.mutable_data(index, position.y(), position.x()) = 1;
-                }
-            }
-            std::fill(states.mutable_data(index), states.mutable_data(index) + HEIGHT * WIDTH, b.m_curPlayer == Player::Black);
-
+            py::array_t<std::uint8_t> states({ Sample::Planes, (int)HEIGHT, (int)WIDTH }); // 先y再x
+            Sample::EncodeStates(b, states.mutable_data());
             return states;
         }, "Feature planes: [X_t, Y_t, Z_t, y_t-1, x_t-2, C<is_black>]")
+        .def_static("encode_batch", [](const std::vector<const Board*>& boards) {
+            py::array_t<std::uint8_t> states({ (int)boards.size(), Sample::Planes, (int)HEIGHT, (int)WIDTH });
+            for (size_t i = 0; i < boards.size(); ++i) {
+                Sample::EncodeStates(*boards[i], states.mutable_data(i));
+            }
+            return states;
+        }, py::arg("boards"), "Stacked network inputs of the boards, written in place into one array")
         .def("__repr__", [](const Board& b) { return py::str("Board(cur_player: {})").format(std::to_string(b.m_curPlayer)); })
         .def("__str__",  [](const Board& b) { return std::to_string(b); });
 }
@@ -1,5 +1,10 @@
 #include "pch.h"
 #include "lib/include/MCTS.h"
+#include "lib/include/Transposition.h"
+#include "lib/include/OpeningBook.h"
+#include "lib/include/SelfPlay.h"
+#include "lib/include/algorithms/MonteCarlo.hpp"
+#include "numpy_ext.hpp"
 
 //using namespace Gomoku;
 //using namespace std;
@@ -8,6 +13,40 @@ inline void MCTS_Ext(py::module& mod) {
     // Expose the core lib namespace
     using namespace Gomoku;
     using namespace std;
+    using namespace py::literals;
+
+    // Children are exposed in place: indexing yields the tree's own nodes, and the contiguous statistics
+    // are read-only numpy views that stay valid as long as the node is part of the tree
+    py::class_<ChildList>(mod, "ChildList", "Children of a MCTS node with their statistics stored contiguously")
+        .def("__len__", &ChildList::size)
+        .def("__getitem__", [](const ChildList& c, size_t i) {
+            if (i >= c.size()) throw py::index_error();
+            return c[i];
+        }, py::return_value_policy::reference_internal)
+        .def("__iter__", [](const ChildList& c) {
+            return py::make_iterator(c.begin(), c.end(), py::return_value_policy::reference_internal);
+        }, py::keep_alive<0, 1>())
+        .def_property_readonly("positions", [](py::object self) {
+            const auto& c = self.cast<const ChildList&>();
+            if (c.size() == 0) { // The buffer may not be allocated yet
+                return py::array_t<short>(0);
+            }
+            return ReadonlyView<short>({ (py::ssize_t)c.size() }, &c.positions()->id, self);
+        })
+        .def_property_readonly("priors", [](py::object self) {
+            const auto& c = self.cast<const ChildList&>();
+            return ReadonlyView<float>({ (py::ssize_t)c.size() }, c.priors(), self);
+        })
+        .def_property_readonly("values", [](py::object self) {
+            const auto& c = self.cast<const ChildList&>();
+            return ReadonlyView<float>({ (py::ssize_t)c.size() }, c.values(), self);
+        })
+        .def_property_readonly("visits", [](py::object self) {
+            const auto& c = self.cast<const ChildList&>();
+            return ReadonlyView<std::uint32_t>({ (py::ssize_t)c.size() }, c.visits(), self);
+        });
+
+    static_assert(sizeof(Position) == sizeof(short), "positions are viewed as an int16 array");
 
     py::class_<Node>(mod, "Node", "MCTS Tree Node")
         .def(py::init<Node*, Position, Player, float, float>(),
@@ -20,16 +59,20 @@ inline void MCTS_Ext(py::module& mod) {
         .def_readonly("parent", &Node::parent)
         .def_readonly("position", &Node::position)
         .def_readonly("player", &Node::player)
-        .def_readwrite("state_value", &Node::state_value)
-        .def_readwrite("action_prob", &Node::action_prob)
-        .def_readwrite("node_visits", &Node::node_visits)
-        .def_property_readonly("children", [](const Node* n) {
-            py::list children(n->children.size());
-            for (int i = 0; i < children.size(); ++i) {  // py::list do not support writing by iterator
-                children[i] = n->children[i].get();                
-            }
-            return children;
+        // Setters also sync the stats stored contiguously in the parent's children
+        .def_property("state_value", [](const Node* n) { return n->state_value; }, [](Node* n, float v) {
+            n->state_value = v;
+            if (n->parent) n->parent->children.sync(n);
+        })
+        .def_property("action_prob", [](const Node* n) { return n->action_prob; }, [](Node* n, float p) {
+            n->action_prob = p;
+            if (n->parent) n->parent->children.sync(n);
         })
+        .def_property("node_visits", [](const Node* n) { return n->node_visits; }, [](Node* n, size_t v) {
+            n->node_visits = v;
+            if (n->parent) n->parent->children.sync(n);
+        })
+        .def_property_readonly("children", [](const Node* n) { return &n->children; }, py::return_value_policy::reference_internal)
         .def("is_leaf", &Node::isLeaf)
         .def("is_full", &Node::isFull)
         .def("__repr__", [](const Node* n) { 
@@ -41,12 +84,14 @@ inline void MCTS_Ext(py::module& mod) {
 
     // Register Policy class with shared_ptr holder type
     py::class_<Policy, std::shared_ptr<Policy>>(mod, "Policy", "MCTS Tree Policy")
-        .def(py::init<Policy::SelectFunc, Policy::ExpandFunc, Policy::EvalFunc, Policy::UpdateFunc, double>(),
+        .def(py::init<Policy::SelectFunc, Policy::ExpandFunc, Policy::EvalFunc, Policy::UpdateFunc, double, Policy::BatchEvalFunc, size_t>(),
             py::arg("select") = nullptr,
             py::arg("expand") = nullptr,
             py::arg("eval_state") = nullptr,
             py::arg("back_prop") = nullptr,
-            py::arg("c_puct") = C_PUCT
+            py::arg("c_puct") = C_PUCT,
+            py::arg("eval_batch") = nullptr,
+            py::arg("c_batch") = C_BATCH_SIZE
         )
         .def("prepare", &Policy::prepare)
         .def("clean_up", &Policy::cleanup)
@@ -54,36 +99,270 @@ inline void MCTS_Ext(py::module& mod) {
         .def("revert_move", &Policy::revertMove)
         .def("check_game_end", &Policy::checkGameEnd)
         .def("create_node", &Policy::createNode)
+        // Expands from a list of (position, prior) pairs, reserving exactly len(probs) children
+        .def("expand_sparse", [](Policy& p, Node* node, Board& board, const Policy::SparseProbs& probs) {
+            return Algorithms::Default::Expand(&p, node, board, probs);
+        }, py::arg("node"), py::arg("board"), py::arg("probs"))
+        .def("clone", &Policy::clone) // None if the policy is not clonable
         .def_readonly("select", &Policy::select)
         .def_readonly("expand", &Policy::expand)
         .def_readonly("eval_state", &Policy::simulate)
         .def_readonly("back_prop", &Policy::backPropogate)
+        .def_readonly("eval_batch", &Policy::simulateBatch)
+        .def_readwrite("c_batch", &Policy::c_batchSize)
+        .def_readwrite("c_widening", &Policy::c_widening)
         .def("__repr__", [](const Policy& p) { return py::str("Policy(c_puct: {}, init_acts: {})").format(p.c_puct, p.m_initActs); });
 
 
+    py::class_<TranspositionTable, std::shared_ptr<TranspositionTable>>(mod, "TranspositionTable", "Cache of evaluation results keyed by Zobrist hash")
+        .def(py::init<size_t, bool>(), py::arg("capacity") = 1 << 16, py::arg("c_symmetric") = false)
+        .def_readonly("c_symmetric", &TranspositionTable::c_symmetric)
+        .def_property_readonly("capacity", &TranspositionTable::capacity)
+        .def_property_readonly("hit_rate", &TranspositionTable::hitRate)
+        .def_property_readonly("stats", [](const TranspositionTable& t) {
+            auto [probes, hits, stores, overwrites] = t.stats();
+            return py::dict("probes"_a = probes, "hits"_a = hits, "stores"_a = stores, "overwrites"_a = overwrites);
+        })
+        .def("probe", py::overload_cast<uint64_t>(&TranspositionTable::probe), py::arg("hash"))
+        .def("store", py::overload_cast<uint64_t, const Policy::EvalResult&>(&TranspositionTable::store), py::arg("hash"), py::arg("result"))
+        .def("clear", &TranspositionTable::clear)
+        .def_static("hash", &TranspositionTable::Hash, py::arg("board"))
+        .def("__repr__", [](const TranspositionTable& t) { return py::str("TranspositionTable(capacity: {}, hit_rate: {})").format(t.capacity(), t.hitRate()); });
+
+
+    py::class_<EvaluationCache, std::shared_ptr<EvaluationCache>>(mod, "EvaluationCache", "Sharded LRU cache of (value, sparse priors) keyed by canonical hash")
+        .def(py::init<size_t, bool, size_t>(), py::arg("c_memory") = C_CACHE_MEMORY, py::arg("c_symmetric") = true, py::arg("c_shards") = C_CACHE_SHARDS)
+        .def_readonly("c_memory", &EvaluationCache::c_memory) // Memory cap in bytes, split evenly among the shards
+        .def_readonly("c_symmetric", &EvaluationCache::c_symmetric)
+        .def_property_readonly("size", &EvaluationCache::size)
+        .def_property_readonly("memory", &EvaluationCache::memory) // Estimated bytes in use
+        .def_property_readonly("hit_rate", &EvaluationCache::hitRate)
+        .def_property_readonly("stats", [](const EvaluationCache& c) {
+            auto [probes, hits, stores, evictions] = c.stats();
+            return py::dict("probes"_a = probes, "hits"_a = hits, "misses"_a = probes - hits, "stores"_a = stores, "evictions"_a = evictions);
+        })
+        .def("probe", &EvaluationCache::probe, py::arg("board"))
+        .def("store", &EvaluationCache::store, py::arg("board"), py::arg("result"))
+        .def("clear", &EvaluationCache::clear)
+        .def("wrap", [](shared_ptr<EvaluationCache> c, Policy::EvalFunc eval_state) {
+            return EvaluationCache::Cached(std::move(c), std::move(eval_state));
+        }, py::arg("eval_state")) // Cached eval_state for Policy, only misses reach the Python callback
+        .def("wrap_batch", [](shared_ptr<EvaluationCache> c, Policy::BatchEvalFunc eval_batch) {
+            return EvaluationCache::Cached(std::move(c), std::move(eval_batch));
+        }, py::arg("eval_batch")) // Cached eval_batch for Policy, only misses are passed on in one batch
+        .def("__repr__", [](const EvaluationCache& c) { return py::str("EvaluationCache(size: {}, memory: {}, hit_rate: {})").format(c.size(), c.memory(), c.hitRate()); });
+
+
+    py::class_<OpeningBook, std::shared_ptr<OpeningBook>>(mod, "OpeningBook", "Memory-mapped book of root visit counts keyed by canonical hash")
+        .def(py::init<>())
+        .def(py::init<const std::string&>(), py::arg("path"))
+        .def_property_readonly("size", &OpeningBook::size)
+        .def("lookup", &OpeningBook::lookup, py::arg("board"))
+        .def_static("generate", [](const std::string& path, shared_ptr<Policy> policy, size_t iterations, int plies, size_t width) {
+            py::gil_scoped_release release;
+            OpeningBook::Write(path, OpeningBook::Generate(std::move(policy), iterations, plies, width));
+        }, // Offline tool: search the openings and write the book to path
+            py::arg("path"),
+            py::arg("policy"),
+            py::arg("iterations") = C_BOOK_ITERATIONS,
+            py::arg("plies") = C_BOOK_PLIES,
+            py::arg("width") = C_BOOK_WIDTH
+        )
+        .def("__repr__", [](const OpeningBook& b) { return py::str("OpeningBook(size: {})").format(b.size()); });
+
+
+    py::class_<TimeManager, std::shared_ptr<TimeManager>>(mod, "TimeManager", "Per-move time budgets out of a total game budget")
+        .def(py::init<milliseconds, milliseconds, milliseconds, size_t>(),
+            py::arg("total"),
+            py::arg("min_move"),
+            py::arg("max_move"),
+            py::arg("c_moves_to_go") = C_MOVES_TO_GO
+        )
+        .def_readwrite("c_close_ratio", &TimeManager::c_closeRatio)
+        .def_readonly("remaining", &TimeManager::m_remaining)
+        .def_readonly("budget", &TimeManager::m_budget)
+        .def_readonly("spent", &TimeManager::m_spent)
+        .def_readonly("stopped_early", &TimeManager::m_stoppedEarly)
+        .def_readonly("extended", &TimeManager::m_extended)
+        .def("reset", &TimeManager::reset);
+
+    py::class_<SearchStats>(mod, "SearchStats", "Counters of the last search, summed over threads")
+        .def_readonly("time", &SearchStats::time) // Per phase: select, simulate, expand, backprop. Zero unless MCTS.profile is set
+        .def_readonly("calls", &SearchStats::calls)
+        .def_readonly("nodes", &SearchStats::nodes)
+        .def_readonly("expansions", &SearchStats::expansions)
+        .def_readonly("max_depth", &SearchStats::maxDepth)
+        .def_readonly("applies", &SearchStats::applies)
+        .def_readonly("reverts", &SearchStats::reverts)
+        .def_readonly("cache_hits", &SearchStats::cacheHits)
+        .def_readonly("cache_misses", &SearchStats::cacheMisses)
+        .def_property_readonly("average_depth", &SearchStats::averageDepth)
+        .def_property_readonly("branching", &SearchStats::branching)
+        .def_property_readonly("hit_ratio", &SearchStats::hitRatio);
+
     py::class_<MCTS>(mod, "MCTS", "Monte Carlo Tree Search")
-        .def(py::init<milliseconds, Position, Player, shared_ptr<Policy>>(),
+        .def(py::init<milliseconds, Position, Player, shared_ptr<Policy>, size_t>(),
             py::arg("c_duration") = 960ms,
             py::arg("last_move") = Position(-1),
             py::arg("last_player") = Player::White,
-            py::arg_v("policy", nullptr, "Default Policy")
+            py::arg_v("policy", nullptr, "Default Policy"),
+            py::arg("c_threads") = 1
         )
-        .def(py::init<size_t, Position, Player, shared_ptr<Policy>>(),
+        .def(py::init<size_t, Position, Player, shared_ptr<Policy>, size_t>(),
             py::arg("c_iterations"),
             py::arg("last_move") = Position(-1),
             py::arg("last_player") = Player::White,
-            py::arg_v("policy", nullptr, "Default Policy")
+            py::arg_v("policy", nullptr, "Default Policy"),
+            py::arg("c_threads") = 1
         )
         .def_readonly("size", &MCTS::m_size)
+        .def_readonly("memory", &MCTS::m_memory)
+        .def_readwrite("memory_limit", &MCTS::c_memoryLimit) // In bytes, 0 for unlimited
+        .def_readwrite("async_reclaim", &MCTS::c_asyncReclaim) // Discarded subtrees are freed on a background thread
+        .def_readwrite("history_depth", &MCTS::c_historyDepth) // Ancestors kept for undo and reset, 0 to discard them
+        .def_property_readonly("depth", [](const MCTS& m) -> py::object {
+            return m.m_depth == SIZE_MAX ? py::none() : py::int_(m.m_depth);
+        }) // Moves on the board at the root, None until located by the first sync
         .def_readonly("iterations", &MCTS::m_iterations)
         .def_readonly("duration", &MCTS::m_duration)
+        .def_readwrite("timer", &MCTS::m_timer) // None for a fixed duration per move
+        .def_readonly("stats", &MCTS::m_stats)
+        .def_readwrite("profile", &MCTS::c_profile) // Time each search phase
+        .def_readonly("proven_move", &MCTS::m_provenMove) // Winning move proven by the policy before the last search, -1 if none
         .def_property_readonly("root", [](const MCTS& m) { return m.m_root.get(); })
         .def_property_readonly("policy", [](const MCTS& m) { return m.m_policy.get(); })
-        .def("get_action", &MCTS::getAction)
-        .def("eval_state", &MCTS::evalState)
-        .def("step_forward", [](MCTS& m) { m.stepForward(); }) // Return value couldn't be exposed since it may get GC. 
-        .def("step_forward", [](MCTS& m, Position p) { m.stepForward(p); }, py::arg("next_move"))
-        .def("sync_with_board", &MCTS::syncWithBoard)
-        .def("reset", &MCTS::reset)
+        .def_readwrite("table", &MCTS::m_table)
+        // Searching and tree maintenance run without the GIL, letting Python threads drive several searches at once.
+        // Callbacks of policies written in Python reacquire it by themselves. The board must not be mutated meanwhile.
+        .def("get_action", &MCTS::getAction, py::call_guard<py::gil_scoped_release>())
+        .def("eval_state", &MCTS::evalState, py::call_guard<py::gil_scoped_release>())
+        .def("root_visits", [](MCTS& m, Board& b) {
+            Eigen::VectorXf visits;
+            {
+                py::gil_scoped_release release;
+                visits = m.rootVisits(b);
+            }
+            return TakeVector(std::move(visits));
+        }, py::arg("board")) // Moved into numpy without copying
+        .def("step_forward", [](MCTS& m) { m.stepForward(); }, py::call_guard<py::gil_scoped_release>()) // Return value couldn't be exposed since it may get GC. 
+        .def("step_forward", [](MCTS& m, Position p) { m.stepForward(p); }, py::arg("next_move"), py::call_guard<py::gil_scoped_release>())
+        .def("step_back", [](MCTS& m) { m.stepBack(); }, py::call_guard<py::gil_scoped_release>()) // No-op without kept ancestors
+        .def("sync_with_board", &MCTS::syncWithBoard, py::call_guard<py::gil_scoped_release>())
+        .def("start_pondering", &MCTS::startPondering, py::arg("board"), py::call_guard<py::gil_scoped_release>())
+        .def("stop_pondering", &MCTS::stopPondering, py::call_guard<py::gil_scoped_release>())
+        .def_readonly("ponder_iterations", &MCTS::m_ponderIterations)
+        .def("reset", &MCTS::reset, py::call_guard<py::gil_scoped_release>())
         .def("__repr__", [](const MCTS& m) { return py::str("MCTS(root_player: {}, nodes: {})").format(m.m_root->player, m.m_size); });
-}
\ No newline at end of file
+
+
+    py::class_<EnsembleMCTS>(mod, "EnsembleMCTS", "Root-parallel Monte Carlo Tree Search")
+        .def(py::init<milliseconds, Position, Player, shared_ptr<Policy>, size_t>(),
+            py::arg("c_duration") = 960ms,
+            py::arg("last_move") = Position(-1),
+            py::arg("last_player") = Player::White,
+            py::arg_v("policy", nullptr, "Default Policy"),
+            py::arg("c_trees") = 2
+        )
+        .def(py::init<size_t, Position, Player, shared_ptr<Policy>, size_t>(),
+            py::arg("c_iterations"),
+            py::arg("last_move") = Position(-1),
+            py::arg("last_player") = Player::White,
+            py::arg_v("policy", nullptr, "Default Policy"),
+            py::arg("c_trees") = 2
+        )
+        .def_readonly("size", &EnsembleMCTS::m_size)
+        .def_readonly("iterations", &EnsembleMCTS::m_iterations)
+        .def_readonly("duration", &EnsembleMCTS::m_duration)
+        .def_property_readonly("trees", [](const EnsembleMCTS& m) {
+            py::list trees(m.m_trees.size());
+            for (int i = 0; i < trees.size(); ++i) {
+                trees[i] = m.m_trees[i].get();
+            }
+            return trees;
+        })
+        .def("get_action", &EnsembleMCTS::getAction, py::call_guard<py::gil_scoped_release>())
+        .def("eval_state", &EnsembleMCTS::evalState, py::call_guard<py::gil_scoped_release>())
+        .def("merge_roots", [](const EnsembleMCTS& m) {
+            auto [visits, values, state_value] = m.mergeRoots();
+            return py::make_tuple(TakeVector(std::move(visits)), TakeVector(std::move(values)), state_value);
+        })
+        .def("sync_with_board", &EnsembleMCTS::syncWithBoard, py::call_guard<py::gil_scoped_release>())
+        .def("reset", &EnsembleMCTS::reset, py::call_guard<py::gil_scoped_release>())
+        .def("__repr__", [](const EnsembleMCTS& m) { return py::str("EnsembleMCTS(trees: {}, nodes: {})").format(m.m_trees.size(), m.m_size); });
+
+
+    // Samples are returned as (state_batch, value_batch, probs_batch), the same layout as network.data_helper.parse_batch
+    auto to_batches = [](const vector<Sample>& samples) {
+        const auto count = (py::ssize_t)samples.size();
+        py::array_t<unsigned char> states({ count, (py::ssize_t)Sample::Planes, (py::ssize_t)HEIGHT, (py::ssize_t)WIDTH });
+        py::array_t<float> values(count);
+        py::array_t<float> probs({ count, (py::ssize_t)BOARD_SIZE });
+        for (py::ssize_t i = 0; i < count; ++i) {
+            std::copy(samples[i].states.begin(), samples[i].states.end(), states.mutable_data(i));
+            *values.mutable_data(i) = samples[i].value;
+            std::copy(samples[i].probs.begin(), samples[i].probs.end(), probs.mutable_data(i));
+        }
+        return py::make_tuple(states, values, probs);
+    };
+
+    // Search results are returned as a list of (move, state_value, action_probs)
+    auto to_results = [](vector<SearchResult>& results) {
+        py::list list;
+        for (auto& result : results) {
+            list.append(py::make_tuple(result.move, result.value, TakeVector(std::move(result.probs))));
+        }
+        return list;
+    };
+
+    py::class_<SelfPlay>(mod, "SelfPlay", "Native self-play data generator running games on parallel workers")
+        .def(py::init<shared_ptr<Policy>, size_t, size_t>(),
+            py::arg_v("policy", nullptr, "Default Policy"),
+            py::arg("c_iterations") = C_SELFPLAY_ITERATIONS,
+            py::arg("c_workers") = 1
+        )
+        .def_readwrite("c_augment", &SelfPlay::c_augment)
+        .def_readonly("iterations", &SelfPlay::c_iterations)
+        .def_readonly("workers", &SelfPlay::c_workers)
+        .def("play", [to_batches](SelfPlay& s, size_t games) {
+            vector<Sample> samples;
+            {
+                py::gil_scoped_release release; // Python callbacks of policies reacquire the GIL by themselves
+                samples = s.play(games);
+            }
+            return to_batches(samples);
+        }, py::arg("games"))
+        .def("play_to_shard", [](SelfPlay& s, size_t games, const std::string& path) {
+            py::gil_scoped_release release;
+            ShardWriter writer(path);
+            s.play(games, [&](vector<Sample>& samples) { writer.write(samples); });
+            writer.close();
+            return writer.size();
+        }, py::arg("games"), py::arg("path")) // Streams samples of each finished game into a shard, returns the sample count
+        .def_static("read_shard", [to_batches](const std::string& path) {
+            return to_batches(ShardWriter::Read(path));
+        }, py::arg("path"))
+        .def("search", [to_results](const SelfPlay& s, const vector<Board>& boards) {
+            vector<SearchResult> results;
+            {
+                py::gil_scoped_release release;
+                results = s.search(boards);
+            }
+            return to_results(results);
+        }, py::arg("boards"))
+        .def("__repr__", [](const SelfPlay& s) { return py::str("SelfPlay(workers: {}, iterations: {})").format(s.c_workers, s.c_iterations); });
+
+
+    mod.def("run_many", [to_results](const vector<Board>& boards, shared_ptr<Policy> policy, size_t c_iterations, size_t c_workers) {
+        vector<SearchResult> results;
+        {
+            py::gil_scoped_release release;
+            results = SelfPlay(std::move(policy), c_iterations, c_workers).search(boards);
+        }
+        return to_results(results);
+    }, // Searches independent games on c_workers threads inside C++, each on a fresh tree, and returns all results at once
+        py::arg("boards"),
+        py::arg_v("policy", nullptr, "Default Policy"),
+        py::arg("c_iterations") = C_ITERATIONS,
+        py::arg("c_workers") = 1
+    );
+}
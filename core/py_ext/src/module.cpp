@@ -2,6 +2,7 @@
 #include "game_ext.hpp"
 #include "mcts_ext.hpp"
 #include "policy_ext.hpp"
+#include "pattern_ext.hpp"
 
 // General definitions
 PYBIND11_MODULE(CorePyExt, mod) {
@@ -10,4 +11,5 @@ PYBIND11_MODULE(CorePyExt, mod) {
     Game_Ext(mod);
     MCTS_Ext(mod);
     Policy_Ext(mod);
+    Pattern_Ext(mod);
 }
\ No newline at end of file
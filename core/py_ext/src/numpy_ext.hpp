@@ -0,0 +1,23 @@
+#ifndef GOMOKU_PY_EXT_NUMPY_H_
+#define GOMOKU_PY_EXT_NUMPY_H_
+#include "pch.h"
+#include <vector>
+#include <Eigen/Dense>
+
+// Hands the vector over to a numpy array without copying; the array frees it when collected
+inline py::array_t<float> TakeVector(Eigen::VectorXf&& vector) {
+    auto owner = new Eigen::VectorXf(std::move(vector));
+    py::capsule release(owner, [](void* ptr) { delete static_cast<Eigen::VectorXf*>(ptr); });
+    return py::array_t<float>(owner->size(), owner->data(), release);
+}
+
+// Read-only numpy view of memory owned by base, which is kept alive as long as the view.
+// The view follows later changes to the underlying object instead of taking a snapshot.
+template <typename T>
+py::array_t<T> ReadonlyView(std::vector<py::ssize_t> shape, const T* data, py::handle base) {
+    py::array_t<T> view(std::move(shape), data, base);
+    py::detail::array_proxy(view.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+    return view;
+}
+
+#endif // !GOMOKU_PY_EXT_NUMPY_H_
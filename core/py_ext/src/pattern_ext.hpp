@@ -0,0 +1,31 @@
+#include "pch.h"
+#include "lib/include/Pattern.h"
+#include "numpy_ext.hpp"
+
+inline void Pattern_Ext(py::module& mod) {
+    using namespace Gomoku;
+
+    // Score and density maps are read-only (height, width) views into the evaluator, updated as it moves
+    py::class_<Evaluator>(mod, "Evaluator", "Incremental pattern evaluator keeping its own board")
+        .def(py::init<>())
+        .def_property_readonly("board", [](Evaluator& ev) -> const Board& { return ev.board(); }, py::return_value_policy::reference_internal)
+        .def("apply_move", &Evaluator::applyMove, py::arg("move"))
+        .def("revert_move", &Evaluator::revertMove, py::arg("count") = 1)
+        .def("check_end", &Evaluator::checkGameEnd)
+        .def("sync_with_board", py::overload_cast<const Board&>(&Evaluator::syncWithBoard), py::arg("board"))
+        .def("reset", &Evaluator::reset)
+        .def("scores", [](py::object self, Player player, Player perspective) {
+            auto& scores = self.cast<Evaluator&>().scores(player, perspective);
+            return ReadonlyView<int>({ HEIGHT, WIDTH }, scores.data(), self);
+        }, py::arg("player"), py::arg("perspective")) // Scores of player's patterns as seen by perspective
+        .def("density", [](py::object self, Player player, bool weighted) {
+            auto& density = self.cast<Evaluator&>().density(player)[weighted];
+            return ReadonlyView<int>({ HEIGHT, WIDTH }, density.data(), self);
+        }, py::arg("player"), py::arg("weighted") = false) // Stones of player around each point, counted or weighted by Evaluator.BlockWeights
+        .def("encoded_states", [](Evaluator& ev) {
+            py::array_t<std::uint8_t> states({ FeaturePlanes::Planes, (int)HEIGHT, (int)WIDTH });
+            ev.m_boardMap.m_features.copyTo(states.mutable_data());
+            return states;
+        }, "Incrementally maintained feature planes, same layout as Board.encoded_states")
+        .def("__repr__", [](Evaluator& ev) { return py::str("Evaluator(moves: {})").format(ev.board().m_moveRecord.size()); });
+}
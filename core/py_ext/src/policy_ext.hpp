@@ -2,6 +2,7 @@
 #include "lib/include/policies/Random.h"
 #include "lib/include/policies/PoolRAVE.h"
 #include "lib/include/policies/Traditional.h"
+#include "lib/include/policies/AlphaZero.h"
 
 inline void Policy_Ext(py::module& mod) {
     using namespace Gomoku;
@@ -10,27 +11,29 @@ inline void Policy_Ext(py::module& mod) {
 
     py::class_<RandomPolicy, Policy, std::shared_ptr<RandomPolicy>>
         (mod, "RandomPolicy", "Random policy with averaged mutliple rollouts")
-        .def(py::init<double, size_t>(),
+        .def(py::init<double, size_t, double>(),
             py::arg("c_puct") = C_PUCT,
-            py::arg("c_rollouts") = 5
+            py::arg("c_rollouts") = 5,
+            py::arg("c_widening") = C_WIDENING
         )
         .def("__repr__", [](const RandomPolicy& p) { 
             return py::str(
-                "RandomPolicy(c_puct: {}, c_rollouts: {}, init_acts: {})"
-            ).format(p.c_puct, p.c_rollouts, p.m_initActs); 
+                "RandomPolicy(c_puct: {}, c_rollouts: {}, c_widening: {}, init_acts: {})"
+            ).format(p.c_puct, p.c_rollouts, p.c_widening, p.m_initActs); 
         });
 
 
     py::class_<PoolRAVEPolicy, Policy, std::shared_ptr<PoolRAVEPolicy>>
         (mod, "PoolRAVEPolicy", "PoolRAVE policy with MC-RAVE algorithm")
-        .def(py::init<double, double>(),
+        .def(py::init<double, double, double>(),
             py::arg("c_puct") = 2,
-            py::arg("c_bias") = 0
+            py::arg("c_bias") = 0,
+            py::arg("c_widening") = C_WIDENING
         )
         .def("__repr__", [](const PoolRAVEPolicy& p) { 
             return py::str(
-                "PoolRAVEPolicy(c_puct: {}, c_bias: {}, init_acts: {})"
-            ).format(p.c_puct, p.c_bias, p.m_initActs); 
+                "PoolRAVEPolicy(c_puct: {}, c_bias: {}, c_widening: {}, init_acts: {})"
+            ).format(p.c_puct, p.c_bias, p.c_widening, p.m_initActs); 
         });
 
 
@@ -41,6 +44,8 @@ inline void Policy_Ext(py::module& mod) {
             py::arg("c_bias") = 0,
             py::arg("use_rave") = false
         )
+        .def_readwrite("c_root_nodes", &TraditionalPolicy::c_rootNodes) // VCF node budget at the root each move, 0 to disable
+        .def_readwrite("c_leaf_nodes", &TraditionalPolicy::c_leafNodes) // VCF node budget before each leaf evaluation, 0 to disable
         .def("__repr__", [](const TraditionalPolicy& p) { 
             if (p.c_useRave) {
                 return py::str(
@@ -52,4 +57,19 @@ inline void Policy_Ext(py::module& mod) {
                 ).format(p.c_puct, p.m_initActs, p.m_cachedActs);
             }
         });
+
+
+    py::class_<AlphaZeroPolicy, Policy, std::shared_ptr<AlphaZeroPolicy>>
+        (mod, "AlphaZeroPolicy", "Policy-value network policy with native batched inference")
+        .def(py::init<const std::string&, double, size_t>(),
+            py::arg("model_path"), // weights exported by PolicyValueNetwork.export_native
+            py::arg("c_puct") = C_PUCT,
+            py::arg("c_batch") = C_BATCH_SIZE
+        )
+        .def_readwrite("cache", &AlphaZeroPolicy::m_cache) // EvaluationCache shared by clones, None to disable
+        .def("__repr__", [](const AlphaZeroPolicy& p) { 
+            return py::str(
+                "AlphaZeroPolicy(c_puct: {}, c_batch: {}, init_acts: {})"
+            ).format(p.c_puct, p.c_batchSize, p.m_initActs); 
+        });
 }
\ No newline at end of file
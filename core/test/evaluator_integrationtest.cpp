@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "lib/include/Pattern.h"
+#include <thread>
 
 using namespace Gomoku;
 using namespace std;
@@ -9,6 +10,85 @@ protected:
     Evaluator ev;
 };
 
+// ģʽ£̲һʱӦ׳쳣رպֻ
+TEST_F(EvaluatorTest, CheckedMode) {
+    ASSERT_TRUE(Evaluator::Checked) << "tests should always run with checked evaluator";
+    ev.applyMove({ 7, 7 });
+    ev.scores(Player::Black, Player::Black)[Position(7, 7)] = 1; // Ϊƻӵķ
+    EXPECT_THROW(ev.applyMove({ 8, 8 }), std::logic_error);
+    Evaluator::Checked = false;
+    EXPECT_NO_THROW(ev.applyMove({ 6, 6 }));
+    Evaluator::Checked = true;
+}
+
+// Evaluatorصľ̬״̬߳̿ɶʵҽ뵥߳һ
+TEST_F(EvaluatorTest, IndependentInstances) {
+    auto play = [](Evaluator& ev) {
+        RandomEngine engine(2018);
+        for (int i = 0; i < 60 && ev.board().m_curPlayer != Player::None; ++i) {
+            Position move = engine.below(BOARD_SIZE);
+            if (ev.board().checkMove(move)) {
+                ev.applyMove(move);
+            }
+        }
+        ev.revertMove(ev.board().m_moveRecord.size() / 2);
+    };
+    play(ev);
+    Evaluator evs[2];
+    std::thread workers[] = { std::thread(play, std::ref(evs[0])), std::thread(play, std::ref(evs[1])) };
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (auto& other : evs) {
+        ASSERT_EQ(other.board().m_moveRecord, ev.board().m_moveRecord);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(other.m_scores[i], ev.m_scores[i]);
+        }
+    }
+}
+
+// ָպ״̬ӦֱͬþĽȫһ
+TEST_F(EvaluatorTest, SnapshotRestore) {
+    const auto same_state = [](Evaluator& lhs, Evaluator& rhs) {
+        for (int i = 0; i <= BOARD_SIZE; ++i) {
+            for (int j = 0; j < Pattern::Size - 1; ++j) {
+                if (lhs.m_patternDist[i][j].field != rhs.m_patternDist[i][j].field) return false;
+            }
+            for (int j = 0; j < Compound::Size; ++j) {
+                if (lhs.m_compoundDist[i][j].field != rhs.m_compoundDist[i][j].field) return false;
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            if (lhs.m_scores[i] != rhs.m_scores[i] || (lhs.m_density[i / 2][i % 2] != rhs.m_density[i / 2][i % 2]).any()) return false;
+        }
+        return lhs.board().m_moveRecord == rhs.board().m_moveRecord && lhs.m_boardMap.m_hash == rhs.m_boardMap.m_hash;
+    };
+    for (Position move : { Position{ 5, 5 }, Position{ 6, 6 }, Position{ 5, 6 }, Position{ 6, 5 }, Position{ 4, 7 } }) {
+        ev.applyMove(move);
+    }
+    Evaluator::Snapshot root;
+    ev.save(root);
+    Evaluator expected;
+    expected.syncWithBoard(ev.board());
+    for (Position move : { Position{ 7, 4 }, Position{ 3, 8 }, Position{ 4, 4 }, Position{ 7, 7 } }) {
+        ev.applyMove(move);
+    }
+    ev.restore(root);
+    EXPECT_TRUE(same_state(ev, expected));
+    EXPECT_NO_THROW(ev.checkInvariants());
+
+    // ԿΪ׼ͬ
+    Board target = ev.board();
+    target.applyMove({ 8, 8 });
+    target.applyMove({ 2, 2 });
+    for (Position move : { Position{ 7, 4 }, Position{ 3, 8 }, Position{ 4, 4 } }) {
+        ev.applyMove(move);
+    }
+    ev.syncWithBoard(target, root);
+    expected.syncWithBoard(target);
+    EXPECT_TRUE(same_state(ev, expected));
+}
+
 // BUGĲ
 
 /*
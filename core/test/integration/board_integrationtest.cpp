@@ -2,6 +2,7 @@
 #include "lib/include/Game.h"
 #include <algorithm>
 #include <numeric>
+#include <map>
 
 using namespace Gomoku;
 using std::begin;
@@ -35,6 +36,13 @@ protected:
         if ((!(board.m_curPlayer != Player::None) || board.m_winner == Player::None) == false) { // 蕴含关系式
             return ::testing::AssertionFailure() << "Winner is not none when game does not end.";
         }
+        // 空位集合要恰好包含全部空位
+        for (size_t i = 0; i < board.moveCounts(Player::None); ++i) {
+            auto cell = board.m_freeCells[i];
+            if (!board.moveState(Player::None, cell) || board.m_freeIndices[cell] != i) {
+                return ::testing::AssertionFailure() << "Free cell list not compatible with move states at " << i << ".";
+            }
+        }
         return ::testing::AssertionSuccess();
     }
 
@@ -94,6 +102,115 @@ TEST_F(BoardTest, CheckVictory) {
     }
 }
 
+// 空位较少且相邻时，随机落子也应在各空位上均匀分布
+TEST_F(BoardTest, UniformRandomMove) {
+    // 只留下(0,0)、(1,0)、(2,0)及右下角四个空位，顺序扫描的实现会严重偏向右下角
+    for (int id = 3; id < GameConfig::BOARD_SIZE - 1; ++id) {
+        board.applyMove(id, false);
+    }
+    ASSERT_TRUE(trivialCheck(board));
+    ASSERT_EQ(board.moveCounts(Player::None), 4);
+    std::map<int, int> counts;
+    const int samples = 40000;
+    for (int i = 0; i < samples; ++i) {
+        counts[board.getRandomMove()] += 1;
+    }
+    ASSERT_EQ(counts.size(), 4);
+    for (auto [id, count] : counts) {
+        ASSERT_TRUE(board.checkMove(id));
+        EXPECT_NEAR(count, samples / 4, samples / 40) << "random move is biased towards " << id;
+    }
+}
+
+// 跨行相邻的下标不能被当作连珠，贴边的连珠则要能被检测到
+TEST_F(BoardTest, CheckVictoryOnEdge) {
+    // 第一行末的三颗黑棋与第二行首的两颗黑棋在下标上连续，但并不成五
+    Position blacks[5] = { {WIDTH-3,0}, {WIDTH-2,0}, {WIDTH-1,0}, {0,1}, {1,1} };
+    Position whites[5] = { {2,3}, {3,3}, {4,3}, {2,5}, {3,5} };
+    for (int i = 0; i < 5; ++i) {
+        board.applyMove(blacks[i]);
+        ASSERT_FALSE(board.status().end) << "wrapped line counted as victory";
+        board.applyMove(whites[i]);
+        ASSERT_FALSE(board.status().end);
+    }
+    board.reset();
+    // 黑棋沿(-1, 1)方向贴着右下角成五
+    Position diagonal[5] = { {WIDTH-1,HEIGHT-5}, {WIDTH-2,HEIGHT-4}, {WIDTH-3,HEIGHT-3}, {WIDTH-4,HEIGHT-2}, {WIDTH-5,HEIGHT-1} };
+    for (int i = 0; i < 5; ++i) {
+        board.applyMove(diagonal[i]);
+        ASSERT_TRUE(trivialCheck(board));
+        if (i < 4) {
+            ASSERT_FALSE(board.status().end);
+            board.applyMove({ i, 0 });
+        }
+    }
+    ASSERT_TRUE(board.status().end);
+    EXPECT_EQ(board.status().winner, Player::Black);
+}
+
+// 连子数与五连威胁：与逐格探测的结果对照
+TEST_F(BoardTest, RunLength) {
+    constexpr int dx[4] = { 1, 0, 1, -1 }, dy[4] = { 0, 1, 1, 1 };
+    const auto probe = [this](int x, int y, int dx, int dy, Player player) {
+        int count = 0;
+        for (x += dx, y += dy; board.checkBoundary(x, y) && board.moveState(player, { x, y }); x += dx, y += dy) {
+            ++count;
+        }
+        return count;
+    };
+    for (int game = 0; game < 20; ++game) {
+        board.reset();
+        while (board.m_curPlayer != Player::None) {
+            for (int id = 0; id < BOARD_SIZE; ++id) {
+                const Position pose = id;
+                for (auto player : { Player::Black, Player::White }) {
+                    bool five = false;
+                    for (int d = 0; d < 4; ++d) {
+                        int run = probe(pose.x(), pose.y(), dx[d], dy[d], player) + probe(pose.x(), pose.y(), -dx[d], -dy[d], player) + 1;
+                        ASSERT_EQ(board.runLength(pose, player, d), board.moveState(player, pose) ? run : 0) << "at " << id << " in direction " << d;
+                        five |= run >= MAX_RENJU;
+                    }
+                    if (board.moveState(Player::None, pose)) {
+                        ASSERT_EQ(board.completesFive(pose, player), five) << "at " << id;
+                    }
+                }
+            }
+            board.applyMove(board.getRandomMove());
+        }
+    }
+}
+
+// 一次性模拟棋盘：与在Board上以同样的随机序列下至终局的结果一致，且不改变原棋盘
+TEST_F(BoardTest, RolloutBoard) {
+    for (std::uint64_t seed = 0; seed < 200; ++seed) {
+        board.reset();
+        for (int i = 0; i < int(seed % 40); ++i) { // 从不同阶段的局面开始
+            board.applyMove(board.getRandomMove());
+        }
+        if (board.m_curPlayer == Player::None) {
+            continue;
+        }
+        const Board origin = board;
+        RandomEngine light_engine(seed), full_engine(seed);
+        auto [winner, total_moves] = RolloutBoard(board).play(light_engine);
+        ASSERT_EQ(board, origin) << "rollout changed the source board";
+        int count = 0;
+        for (; board.m_curPlayer != Player::None; ++count) {
+            board.applyMove(board.m_freeCells[full_engine.below(uint32_t(board.moveCounts(Player::None)))]);
+        }
+        EXPECT_EQ(winner, board.m_winner);
+        EXPECT_EQ(total_moves, count);
+        // 成批模拟与逐局模拟的结果一致
+        RandomEngine batch_engine(seed), single_engine(seed);
+        auto results = RolloutBoard::PlayMany(origin, 10, batch_engine);
+        std::array<int, 3> expected = {};
+        for (int i = 0; i < 10; ++i) {
+            expected[static_cast<int>(std::get<0>(RolloutBoard(origin).play(single_engine))) + 1] += 1;
+        }
+        EXPECT_EQ(results, expected);
+    }
+}
+
 // 利用一种可以和棋的下法进行检查
 TEST_F(BoardTest, CheckTie) {
     for (int j = 0; j < HEIGHT; ++j) {
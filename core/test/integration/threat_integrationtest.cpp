@@ -0,0 +1,151 @@
+#include "pch.h"
+#include "lib/include/Pattern.h"
+#include "lib/include/algorithms/Threat.hpp"
+#include "lib/include/policies/Traditional.h"
+#include <vector>
+
+using namespace Gomoku;
+using namespace Gomoku::Algorithms;
+using Gomoku::Policies::TraditionalPolicy;
+
+// 穷举棋盘上玩家的成五点，不依赖Evaluator的棋型记录
+static std::vector<Position> FiveSpots(const Board& board, Player player) {
+    std::vector<Position> spots;
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        if (board.checkMove(i) && board.completesFive(i, player)) {
+            spots.push_back(i);
+        }
+    }
+    return spots;
+}
+
+/*
+    沿求解器给出的着法下完VCF，并以穷举复核每一步：
+    攻方每手须成五，或成四且对方无成五点；只有一个成五点时守方挡在该处，随后继续求解。
+    返回攻方所下的手数，期间ev最终恢复原状。
+*/
+static int ExpectForcedWin(ThreatSolver& solver, Evaluator& ev) {
+    auto& board = ev.board();
+    const auto attacker = board.m_curPlayer;
+    int moves = 0, applied = 0;
+    for (;;) {
+        auto result = solver.solve(ev, 1 << 16);
+        EXPECT_EQ(result.proof, result.Win);
+        if (result.proof != result.Win) {
+            break;
+        }
+        EXPECT_TRUE(board.checkMove(result.move));
+        ev.applyMove(result.move), ++applied, ++moves;
+        if (board.m_winner == attacker) {
+            break;
+        }
+        auto spots = FiveSpots(board, attacker);
+        EXPECT_FALSE(spots.empty());
+        EXPECT_TRUE(FiveSpots(board, -attacker).empty());
+        if (spots.size() != 1) {
+            break;
+        }
+        ev.applyMove(spots[0]), ++applied;
+    }
+    ev.revertMove(applied);
+    return moves;
+}
+
+TEST(ThreatSolverTest, ImmediateFive) {
+    Evaluator ev;
+    ev.syncWithBoard(MakeBoard({ { 3, 7 }, { 4, 7 }, { 5, 7 }, { 6, 7 } }, { { 2, 7 }, { 3, 3 }, { WIDTH - 1, HEIGHT - 1 }, { WIDTH - 1, 3 } }));
+    ThreatSolver solver;
+    auto result = solver.solve(ev, 100);
+    EXPECT_EQ(result.proof, result.Win);
+    EXPECT_EQ(result.move, Position(7, 7));
+    EXPECT_EQ(solver.m_nodes, 1);
+}
+
+TEST(ThreatSolverTest, DoubleFour) {
+    // 黑棋在(6,5)落子，同时形成横向与纵向的冲四
+    Evaluator ev;
+    ev.syncWithBoard(MakeBoard(
+        { { 3, 5 }, { 4, 5 }, { 5, 5 }, { 6, 2 }, { 6, 3 }, { 6, 4 } },
+        { { 2, 5 }, { 6, 1 }, { 0, 0 }, { WIDTH - 1, 0 }, { 0, HEIGHT - 1 }, { WIDTH - 1, HEIGHT - 1 } }
+    ));
+    ThreatSolver solver;
+    auto result = solver.solve(ev, 100);
+    ASSERT_EQ(result.proof, result.Win);
+    EXPECT_EQ(result.move, Position(6, 5));
+    EXPECT_EQ(ExpectForcedWin(solver, ev), 1);
+}
+
+TEST(ThreatSolverTest, MustBlockFirst) {
+    // 白棋已成四：黑棋的冲四不能抢先，挡住后黑棋也无后续的四
+    Evaluator ev;
+    ev.syncWithBoard(MakeBoard(
+        { { 5, 7 }, { 6, 7 }, { 7, 7 }, { 3, 2 }, { WIDTH - 1, HEIGHT - 1 } },
+        { { 4, 7 }, { 3, 3 }, { 3, 4 }, { 3, 5 }, { 3, 6 } }
+    ));
+    ThreatSolver solver;
+    EXPECT_EQ(solver.solve(ev, 100).proof, ThreatSolver::Result::Unknown);
+
+    // 白棋活四，黑棋无从应对
+    ev.syncWithBoard(MakeBoard(
+        { { 5, 7 }, { 6, 7 }, { 0, 0 }, { WIDTH - 1, HEIGHT - 1 } },
+        { { 3, 4 }, { 3, 5 }, { 3, 6 }, { 3, 7 } }
+    ));
+    EXPECT_EQ(solver.solve(ev, 100).proof, ThreatSolver::Result::Loss);
+}
+
+TEST(ThreatSolverTest, RandomPositions) {
+    // 随机局面上，每个被证明的必胜均为成立的VCF；预算耗尽时不缓存结论
+    RandomEngine engine(2019);
+    ThreatSolver solver;
+    int wins = 0, long_wins = 0;
+    for (int round = 0; round < 60; ++round) {
+        Board board;
+        for (int i = 0, moves = 20 + engine.below(40); i < moves && board.m_curPlayer != Player::None; ++i) {
+            board.applyMove(board.m_freeCells[engine.below(uint32_t(board.moveCounts(Player::None)))]); // 由固定种子落子，结果可复现
+        }
+        if (board.m_curPlayer == Player::None) {
+            continue;
+        }
+        Evaluator ev;
+        ev.syncWithBoard(board);
+        const auto record = ev.board().m_moveRecord;
+        auto result = solver.solve(ev, 1024);
+        EXPECT_EQ(ev.board().m_moveRecord, record);
+        if (result.proof == result.Win) {
+            ++wins;
+            long_wins += ExpectForcedWin(solver, ev) > 1;
+        } else if (result.proof == result.Unknown && !solver.m_aborted) {
+            EXPECT_TRUE(FiveSpots(board, board.m_curPlayer).empty());
+        }
+    }
+    EXPECT_GT(long_wins, 0);
+    EXPECT_GE(wins, long_wins);
+}
+
+TEST(ThreatSolverTest, Budget) {
+    ThreatSolver solver;
+    EXPECT_THROW(ThreatSolver(C_VCF_DEPTH, 1000), std::invalid_argument);
+    Evaluator ev;
+    ev.syncWithBoard(MakeBoard({ { 7, 7 } }, {}));
+    auto result = solver.solve(ev, 0);
+    EXPECT_EQ(result.proof, result.Unknown);
+    EXPECT_EQ(solver.m_nodes, 0);
+}
+
+TEST(MCTSTest, ProvenRootSkipsSearch) {
+    // 根局面有VCF时，不进行Playout，直接落下首手
+    auto board = MakeBoard(
+        { { 3, 5 }, { 4, 5 }, { 5, 5 }, { 6, 2 }, { 6, 3 }, { 6, 4 } },
+        { { 2, 5 }, { 6, 1 }, { 0, 0 }, { WIDTH - 1, 0 }, { 0, HEIGHT - 1 }, { WIDTH - 1, HEIGHT - 1 } }
+    );
+    auto policy = std::make_shared<TraditionalPolicy>();
+    MCTS mcts(size_t(200), board.m_moveRecord.back(), -board.m_curPlayer, policy);
+    EXPECT_EQ(mcts.getAction(board), Position(6, 5));
+    EXPECT_EQ(mcts.m_stats.calls[SearchStats::Select], 0);
+
+    policy->c_rootNodes = 0; // 关闭后照常搜索
+    MCTS searched(size_t(200), board.m_moveRecord.back(), -board.m_curPlayer, policy);
+    searched.getAction(board);
+    EXPECT_EQ(searched.m_provenMove, Position::npos);
+    EXPECT_GT(searched.m_stats.calls[SearchStats::Select], 0);
+}
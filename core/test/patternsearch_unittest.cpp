@@ -1,8 +1,10 @@
 #include "pch.h"
+#include <fstream>
 #include <string>
 #define private public
 #include "lib/include/Pattern.h"
 #include "lib/src/utils/ACAutomata.h"
+#include "lib/src/PatternTables.h"
 #undef private
 
 namespace Gomoku {
@@ -249,4 +251,58 @@ TEST_F(PatternSearchTest, InvariantState) {
         state = ps.m_base[state] + code;
     }
     EXPECT_TRUE(state == ps.m_invariants[code]);
-}
\ No newline at end of file
+}
+
+TEST_F(PatternSearchTest, LookupTable) {
+    auto& ps = Evaluator::Patterns;
+    RandomEngine engine(2018);
+    string target(TARGET_LEN, 0);
+    PatternSearch::Entries entries;
+    for (int n = 0; n < 100000; ++n) {
+        for (auto& code : target) {
+            code = Codeset[engine.below(std::size(Codeset))];
+        }
+        // ACԶ㡹״̬ظ¼ʱߵĽһ
+        auto overline = [&](char ch) { return target.find(string(6, EncodeCharset(ch))) != string::npos; };
+        if (overline('x') || overline('o')) {
+            continue;
+        }
+        vector<PatternSearch::Entry> expected;
+        for (auto entry : ps.execute(target)) {
+            if (PatternSearch::HasCovered(entry)) {
+                expected.push_back(entry);
+            }
+        }
+        entries.clear();
+        ps.lookup(target, entries);
+        ASSERT_EQ(entries.size(), expected.size());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            ASSERT_EQ(&get<0>(entries[i]), &get<0>(expected[i]));
+            ASSERT_EQ(get<1>(entries[i]), get<1>(expected[i]));
+        }
+    }
+}
+
+TEST(PatternSearchGenerateTest, GeneratedTables) {
+    // ľ̬ʱԭ͹Ľһ£һʱڵǰĿ¼µPatternTables.h
+    PatternSearch built(Evaluator::Prototypes);
+    auto& st = *built.m_storage;
+    auto& ps = Evaluator::Patterns;
+    auto same = [](const vector<int>& values, const int* table, size_t size) {
+        return values.size() == size && std::equal(values.begin(), values.end(), table);
+    };
+    bool synced = same(st.base, ps.m_base, std::size(PatternTables::Base))
+        && same(st.check, ps.m_check, std::size(PatternTables::Check))
+        && same(st.fail, ps.m_fail, std::size(PatternTables::Fail))
+        && same(st.invariants, ps.m_invariants, std::size(PatternTables::Invariants))
+        && same(st.windowFirst, ps.m_windowFirst, std::size(PatternTables::WindowFirst))
+        && same(st.windowPatterns, ps.m_windowPatterns, std::size(PatternTables::WindowPatterns))
+        && st.patterns.size() == std::size(PatternTables::Patterns)
+        && std::equal(st.patterns.begin(), st.patterns.end(), ps.m_patterns);
+    if (!synced) {
+        std::ofstream ofs("PatternTables.h", std::ios::binary);
+        AhoCorasickBuilder::Emit(built, ofs);
+    }
+    EXPECT_TRUE(synced) << "lib/src/PatternTables.h is stale, replace it with ./PatternTables.h";
+    EXPECT_THROW(AhoCorasickBuilder::Emit(ps, std::cout), std::invalid_argument);
+}
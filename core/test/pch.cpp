@@ -4,10 +4,14 @@
 //
 
 #include "pch.h"
+#include "lib/include/Pattern.h"
 #include <ctime>
 
 // seed random generator
 int rndSeed = []() {
     srand(time(nullptr));
     return 0;
-}();
\ No newline at end of file
+}();
+
+// 测试中始终开启Evaluator的一致性检查，与构建类型无关
+bool evaluatorChecked = Gomoku::Evaluator::Checked = true;
\ No newline at end of file
@@ -22,4 +22,18 @@ inline bool operator==(const Board& lhs, const Board& rhs) {
     return make_tied(lhs) == make_tied(rhs);
 }
 
+// 黑白交替落下两方的棋子，用于构造测试局面
+inline Board MakeBoard(const std::vector<Position>& black, const std::vector<Position>& white) {
+    Board board;
+    for (size_t i = 0; i < black.size() || i < white.size(); ++i) {
+        if (i < black.size()) {
+            board.applyMove(black[i]);
+        }
+        if (i < white.size()) {
+            board.applyMove(white[i]);
+        }
+    }
+    return board;
+}
+
 }
\ No newline at end of file
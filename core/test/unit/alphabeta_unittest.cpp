@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "lib/include/AlphaBeta.h"
+
+using namespace Gomoku;
+
+// 黑棋在(6,5)落子即成双四：横向(3,5)~(6,5)与纵向(6,2)~(6,5)。各点均在9路棋盘之内，角上的白子不在两条线上
+static Board DoubleFourBoard() {
+    return MakeBoard(
+        { { 3, 5 }, { 4, 5 }, { 5, 5 }, { 6, 2 }, { 6, 3 }, { 6, 4 } },
+        { { 2, 5 }, { 6, 1 }, { 0, 0 }, { WIDTH - 1, 0 }, { 0, HEIGHT - 1 }, { WIDTH - 1, HEIGHT - 1 } }
+    );
+}
+
+TEST(AlphaBetaTest, ImmediateWin) {
+    auto board = MakeBoard({ { 3, 7 }, { 4, 7 }, { 5, 7 }, { 6, 7 } }, { { 2, 7 }, { 3, 3 }, { WIDTH - 1, HEIGHT - 1 }, { WIDTH - 1, 3 } });
+    AlphaBeta search(1000ms, 1, 1 << 12);
+    search.c_vcfNodes = 0;
+    EXPECT_EQ(search.getAction(board), Position(7, 7));
+    EXPECT_EQ(search.m_score, AlphaBeta::WIN - 1);
+    EXPECT_EQ(board.m_moveRecord.size(), 8); // 棋盘状态不变
+}
+
+TEST(AlphaBetaTest, BlocksFour) {
+    // 白棋已冲四，黑棋自己的冲四不能抢先
+    auto board = MakeBoard(
+        { { 5, 7 }, { 6, 7 }, { 7, 7 }, { 3, 2 }, { WIDTH - 1, HEIGHT - 1 } },
+        { { 4, 7 }, { 3, 3 }, { 3, 4 }, { 3, 5 }, { 3, 6 } }
+    );
+    AlphaBeta search(1000ms, 1, 1 << 12);
+    search.c_vcfNodes = 0;
+    search.c_maxDepth = 2;
+    EXPECT_EQ(search.getAction(board), Position(3, 7));
+    EXPECT_EQ(search.m_depth, 2);
+}
+
+TEST(AlphaBetaTest, FindsDoubleFour) {
+    auto board = DoubleFourBoard();
+    AlphaBeta search(1000ms, 1, 1 << 12);
+    search.c_vcfNodes = 0; // 由搜索本身而非VCF求解器找出
+    search.c_maxDepth = 3;
+    EXPECT_EQ(search.getAction(board), Position(6, 5));
+    EXPECT_EQ(search.m_score, AlphaBeta::WIN - 3);
+    EXPECT_GT(search.m_nodes, 1);
+
+    search.c_vcfNodes = C_VCF_NODES;
+    EXPECT_EQ(search.getAction(board), Position(6, 5));
+    EXPECT_EQ(search.m_depth, 0);
+}
+
+TEST(AlphaBetaTest, TranspositionTable) {
+    // 同一局面的第二次搜索可由置换表直接排序并截断，访问的结点数不会更多
+    Board board;
+    for (auto move : { Position(7, 7), Position(8, 7), Position(7, 6), Position(8, 8), Position(8, 6), Position(7, 8), Position(7, 5) }) {
+        board.applyMove(move);
+    }
+    AlphaBeta search(1000ms, 1, 1 << 16);
+    search.c_maxDepth = 3;
+    auto first = search.getAction(board);
+    auto nodes = search.m_nodes;
+    EXPECT_EQ(search.getAction(board), first);
+    EXPECT_GT(search.m_hits, 0);
+    EXPECT_LE(search.m_nodes, nodes);
+
+    search.reset();
+    EXPECT_EQ(search.getAction(board), first);
+    EXPECT_EQ(search.m_nodes, nodes);
+}
+
+TEST(AlphaBetaTest, TimeControl) {
+    Board board;
+    for (auto move : { Position(7, 7), Position(8, 7), Position(7, 6), Position(8, 8), Position(8, 6), Position(7, 8), Position(7, 5), Position(7, 4), Position(8, 5) }) {
+        board.applyMove(move);
+    }
+    AlphaBeta search(100ms, 1, 1 << 16);
+    search.c_vcfNodes = 0;
+    auto move = search.getAction(board);
+    EXPECT_TRUE(board.checkMove(move));
+    EXPECT_GE(search.m_depth, 1);
+    EXPECT_LT(search.m_duration, 1000ms);
+
+    auto timer = std::make_shared<TimeManager>(2000ms, 10ms, 100ms);
+    search.m_timer = timer;
+    search.getAction(board);
+    EXPECT_LT(timer->m_remaining, 2000ms);
+    EXPECT_LE(search.m_duration, 1000ms);
+}
+
+TEST(AlphaBetaTest, LazySMP) {
+    auto board = DoubleFourBoard();
+    AlphaBeta search(1000ms, 3, 1 << 12);
+    search.c_vcfNodes = 0;
+    search.c_maxDepth = 3;
+    EXPECT_EQ(search.getAction(board), Position(6, 5));
+    EXPECT_EQ(search.m_score, AlphaBeta::WIN - 3);
+    EXPECT_THROW(AlphaBeta(1000ms, 0), std::invalid_argument);
+}
@@ -1,6 +1,11 @@
 #include "pch.h"
 #include "lib/include/MCTS.h"
 #include "lib/include/policies/Traditional.h"
+#include "lib/include/policies/PoolRAVE.h"
+#include "lib/include/policies/Random.h"
+#include "lib/include/algorithms/Vectorized.hpp"
+#include <random>
+#include <thread>
 
 using namespace Gomoku;
 using namespace Gomoku::Policies;
@@ -39,4 +44,482 @@ using namespace Gomoku::Policies;
 //        board.applyMove(next_move);
 //        board_cpy.applyMove(next_move);
 //    }
-//}
\ No newline at end of file
+//}
+// 递归统计以node为根的子树结点数
+static size_t CountNodes(const Node* node) {
+    size_t count = 1;
+    for (auto&& child : node->children) {
+        count += child ? CountNodes(child) : 0; // 祖先中通往根结点的位置留空
+    }
+    return count;
+}
+
+// 树与保留的祖先链中的结点数之和
+static size_t CountNodes(const MCTS& mcts) {
+    size_t count = CountNodes(mcts.m_root.get());
+    for (auto&& ancestor : mcts.m_history) {
+        count += CountNodes(ancestor.get());
+    }
+    return count;
+}
+
+TEST(NodePoolTest, ReuseFreedBlocks) {
+    NodePool pool;
+    NodePool::Scope scope(pool);
+    auto first = std::make_unique<Node>();
+    auto address = first.get();
+    first.reset();
+    ASSERT_EQ(pool.size(), 0);
+    auto second = std::make_unique<Node>();
+    EXPECT_EQ(second.get(), address) << "freed block is not reused";
+    EXPECT_EQ(pool.size(), 1);
+}
+
+TEST(NodePoolTest, OwnerOutlivesScope) {
+    NodePool pool;
+    std::unique_ptr<Node> node;
+    {
+        NodePool::Scope scope(pool);
+        node = std::make_unique<Node>();
+    }
+    ASSERT_EQ(pool.size(), 1);
+    node.reset(); // 离开Scope后销毁，仍应归还到原内存池
+    EXPECT_EQ(pool.size(), 0);
+}
+
+TEST(NodePoolTest, ByteCount) {
+    NodePool pool;
+    NodePool::Scope scope(pool);
+    {
+        Node node;
+        node.children.reserve(BOARD_SIZE);
+        auto child = std::make_unique<Node>();
+        EXPECT_GE(pool.bytes(), sizeof(Node) + BOARD_SIZE * (sizeof(Node*) + 2 * sizeof(float) + sizeof(std::uint32_t) + sizeof(Position)));
+        pool.setBudget(pool.bytes());
+        EXPECT_TRUE(NodePool::Exhausted());
+    }
+    EXPECT_EQ(pool.bytes(), 0);
+    EXPECT_FALSE(pool.exhausted());
+}
+
+TEST(MCTSTest, NodeCount) {
+    Board board;
+    MCTS mcts(size_t(C_ITERATIONS / 20));
+    for (int i = 0; i < 3; ++i) {
+        board.applyMove(mcts.getAction(board));
+        ASSERT_EQ(mcts.m_size, CountNodes(mcts.m_root.get())) << "pool size differs from tree size";
+    }
+    mcts.reset();
+    EXPECT_EQ(mcts.m_size, 1);
+}
+
+// 递归检查父结点中的子结点统计量与子结点自身的字段一致
+static void CheckChildStats(const Node* node) {
+    const auto& children = node->children;
+    for (size_t i = 0; i < children.size(); ++i) {
+        auto child = children[i];
+        ASSERT_EQ(child->index, i);
+        ASSERT_EQ(children.positions()[i], child->position);
+        ASSERT_EQ(children.priors()[i], child->action_prob);
+        ASSERT_EQ(children.values()[i], child->state_value);
+        ASSERT_EQ(children.visits()[i], child->node_visits);
+        CheckChildStats(child);
+    }
+}
+
+TEST(ChildListTest, StatsInSync) {
+    Board board;
+    MCTS mcts(size_t(C_ITERATIONS / 20), -1, Player::White, std::make_shared<PoolRAVEPolicy>());
+    for (int i = 0; i < 2; ++i) {
+        board.applyMove(mcts.getAction(board));
+        CheckChildStats(mcts.m_root.get());
+    }
+}
+
+TEST(ExpandTest, SparseMatchesDense) {
+    Board board;
+    board.applyMove(Position{ 7, 7 });
+    Policy policy;
+    Policy::SparseProbs sparse = { { Position{ 6, 6 }, 0.5f }, { Position{ 7, 7 }, 0.1f }, { Position{ 8, 6 }, 0.3f }, { Position{ 6, 8 }, 0.0f }, { Position{ 8, 8 }, 0.2f } };
+    Eigen::VectorXf dense = Eigen::VectorXf::Zero(BOARD_SIZE);
+    for (auto [pose, prob] : sparse) {
+        dense[pose] = prob;
+    }
+    Node sparse_node, dense_node;
+    ASSERT_EQ(Algorithms::Default::Expand(&policy, &sparse_node, board, sparse), 3) << "occupied and zero-prior positions should be skipped";
+    ASSERT_EQ(Algorithms::Default::Expand(&policy, &dense_node, board, dense), 3);
+    EXPECT_LE(sparse_node.children.capacity(), 8) << "reserved beyond the list length";
+    const Position expected[] = { Position{ 6, 6 }, Position{ 8, 6 }, Position{ 8, 8 } };
+    for (size_t i = 0; i < 3; ++i) {
+        auto child = sparse_node.children[i];
+        EXPECT_EQ(child->position, expected[i]) << "children should follow the list order";
+        EXPECT_EQ(child->action_prob, dense[child->position]);
+    }
+    CheckChildStats(&sparse_node);
+}
+
+// 递归检查逐步展开的进度：已创建的子结点数不超过访问次数允许的数目
+static void CheckWidening(const Policy* policy, const Node* node) {
+    if (!node->children.empty()) {
+        ASSERT_LE(node->children.size(), Algorithms::Default::WideningLimit(policy, node));
+    }
+    for (auto&& child : node->children) {
+        CheckWidening(policy, child);
+    }
+}
+
+TEST(MCTSTest, ProgressiveWidening) {
+    Board board;
+    auto policy = std::make_shared<PoolRAVEPolicy>(1e-4, 1e-1, 1.0);
+    MCTS lazy(size_t(C_ITERATIONS / 20), -1, Player::White, policy);
+    MCTS eager(size_t(C_ITERATIONS / 20), -1, Player::White, std::make_shared<PoolRAVEPolicy>());
+    lazy.evalState(board), eager.evalState(board);
+    const auto& children = lazy.m_root->children;
+    EXPECT_EQ(children.size() + children.pending(), BOARD_SIZE) << "every legal move should be registered";
+    EXPECT_LT(lazy.m_size * 10, eager.m_size) << "children are not created lazily";
+    ASSERT_EQ(lazy.m_size, CountNodes(lazy.m_root.get()));
+    CheckChildStats(lazy.m_root.get());
+    CheckWidening(policy.get(), lazy.m_root.get());
+    // 推进至尚未创建结点的一手时，应按需创建
+    board.applyMove(lazy.getAction(board));
+    ASSERT_NE(lazy.m_root->children.pending(), 0);
+    Position move = lazy.m_root->children.positions()[lazy.m_root->children.size()];
+    board.applyMove(move);
+    lazy.syncWithBoard(board);
+    EXPECT_EQ(lazy.m_root->position, move);
+    ASSERT_EQ(lazy.m_size, CountNodes(lazy.m_root.get()));
+    board.applyMove(lazy.getAction(board));
+    ASSERT_EQ(lazy.m_size, CountNodes(lazy.m_root.get()));
+    CheckChildStats(lazy.m_root.get());
+}
+
+TEST(MCTSTest, MemoryLimit) {
+    Board board;
+    MCTS mcts(size_t(C_ITERATIONS / 20), -1, Player::White, std::make_shared<RandomPolicy>());
+    mcts.c_memoryLimit = 1 << 18;
+    for (int i = 0; i < 3; ++i) {
+        board.applyMove(mcts.getAction(board));
+        ASSERT_EQ(mcts.m_size, CountNodes(mcts.m_root.get()));
+        CheckChildStats(mcts.m_root.get());
+    }
+    mcts.syncWithBoard(board);
+    const auto visits = mcts.m_root->node_visits;
+    mcts.evalState(board);
+    // 达到上限前的最后一次扩展可能越过上限，越过的部分不超过一层子结点
+    EXPECT_LE(mcts.m_memory, mcts.c_memoryLimit + NodePool::MaxBlockSize + BOARD_SIZE * sizeof(Node));
+    EXPECT_EQ(mcts.m_root->node_visits, visits + C_ITERATIONS / 20) << "search should go on after the tree is full";
+}
+
+TEST(MCTSTest, AsyncReclaim) {
+    Board board;
+    MCTS mcts(size_t(C_ITERATIONS / 20), -1, Player::White, std::make_shared<PoolRAVEPolicy>());
+    mcts.c_asyncReclaim = true;
+    for (int i = 0; i < 3; ++i) {
+        board.applyMove(mcts.getAction(board));
+        ASSERT_NE(mcts.m_reclaimer, nullptr);
+        mcts.m_reclaimer->wait();
+        ASSERT_EQ(mcts.m_pool->size(), CountNodes(mcts.m_root.get())) << "discarded subtrees are not reclaimed";
+        CheckChildStats(mcts.m_root.get());
+    }
+    // 回收的块应能被后续的扩展复用
+    const auto capacity = mcts.m_pool->capacity();
+    mcts.syncWithBoard(board);
+    mcts.m_reclaimer->wait();
+    mcts.evalState(board);
+    EXPECT_LE(mcts.m_pool->capacity(), 2 * capacity);
+}
+
+TEST(MCTSTest, TreeReuse) {
+    Board board;
+    MCTS mcts(size_t(C_ITERATIONS / 20), -1, Player::White, std::make_shared<RandomPolicy>());
+    mcts.c_historyDepth = 4;
+    std::vector<Node*> roots; // 各步推进后的根结点
+    for (int i = 0; i < 4; ++i) {
+        board.applyMove(mcts.getAction(board));
+        roots.push_back(mcts.m_root.get());
+        ASSERT_EQ(mcts.m_size, CountNodes(mcts));
+    }
+    ASSERT_EQ(mcts.m_history.size(), 4);
+    EXPECT_EQ(mcts.m_depth, 4);
+
+    // 悔棋后退回原有的祖先，先前的子树重新挂回其下
+    const auto moves = board.m_moveRecord;
+    board.revertMove(3);
+    mcts.syncWithBoard(board);
+    ASSERT_EQ(mcts.m_root.get(), roots[0]);
+    EXPECT_EQ(mcts.m_depth, 1);
+    EXPECT_EQ(mcts.m_size, CountNodes(mcts));
+    CheckChildStats(mcts.m_root.get());
+    EXPECT_EQ(roots[1]->parent, roots[0]);
+    EXPECT_GE(roots[0]->node_visits, roots[1]->node_visits);
+
+    // 以另一种次序下出同样的局面（交换白棋的两手），沿已有的路径推进至原来的结点
+    for (auto move : { moves[3], moves[2], moves[1] }) {
+        board.applyMove(move);
+    }
+    mcts.syncWithBoard(board);
+    EXPECT_EQ(mcts.m_root.get(), roots[3]);
+    EXPECT_EQ(mcts.m_depth, 4);
+    board.applyMove(mcts.getAction(board));
+    ASSERT_EQ(mcts.m_size, CountNodes(mcts));
+
+    // 祖先链不超过c_historyDepth层，重开时无法退回开局则换用新的根结点
+    EXPECT_EQ(mcts.m_history.size(), 4);
+    mcts.reset();
+    EXPECT_EQ(mcts.m_depth, 0);
+    EXPECT_TRUE(mcts.m_history.empty());
+    EXPECT_EQ(mcts.m_size, 1);
+
+    // 祖先链可退回开局时，重开后复用开局的子树
+    board.reset();
+    board.applyMove(mcts.getAction(board));
+    board.applyMove(mcts.getAction(board));
+    mcts.reset();
+    EXPECT_EQ(mcts.m_depth, 0);
+    EXPECT_EQ(mcts.m_root->position, Position::npos);
+    EXPECT_FALSE(mcts.m_root->children.empty());
+    EXPECT_EQ(mcts.m_size, CountNodes(mcts));
+
+    // 不保留祖先时，换了一局的棋盘得到新的根结点，而非在原有的树上续接
+    MCTS plain(size_t(C_ITERATIONS / 20), -1, Player::White, std::make_shared<RandomPolicy>());
+    board.reset();
+    board.applyMove(plain.getAction(board));
+    board.applyMove(plain.getAction(board));
+    auto other = MakeBoard({ { 0, 0 } }, { { WIDTH - 1, HEIGHT - 1 } });
+    plain.syncWithBoard(other);
+    EXPECT_EQ(plain.m_root->position, Position(WIDTH - 1, HEIGHT - 1));
+    EXPECT_EQ(plain.m_depth, 2);
+    EXPECT_EQ(plain.m_size, CountNodes(plain.m_root.get()));
+    EXPECT_TRUE(other.checkMove(plain.getAction(other)));
+}
+
+TEST(MCTSTest, Pondering) {
+    Board board;
+    MCTS mcts(size_t(C_ITERATIONS / 20), -1, Player::White, std::make_shared<RandomPolicy>());
+    board.applyMove(mcts.getAction(board));
+    mcts.startPondering(board);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    mcts.stopPondering();
+    EXPECT_GT(mcts.m_ponderIterations, 0);
+    EXPECT_EQ(board.m_moveRecord.size(), 1) << "pondering changed board state";
+    ASSERT_EQ(mcts.m_size, CountNodes(mcts.m_root.get()));
+    // 对手落子后，应保留后台搜索过的子树
+    const auto& children = mcts.m_root->children;
+    ASSERT_FALSE(children.empty());
+    auto best = std::max_element(children.visits(), children.visits() + children.size()) - children.visits();
+    const auto visits = children.visits()[best];
+    const auto reply = children.positions()[best];
+    mcts.startPondering(board);
+    board.applyMove(reply);
+    mcts.syncWithBoard(board); // 停止后台搜索并推进根结点
+    EXPECT_GE(mcts.m_root->node_visits, visits);
+    ASSERT_EQ(mcts.m_size, CountNodes(mcts.m_root.get()));
+    CheckChildStats(mcts.m_root.get());
+}
+
+TEST(MCTSTest, SearchStats) {
+    Board board;
+    MCTS mcts(size_t(200), -1, Player::White, std::make_shared<TraditionalPolicy>());
+    mcts.c_profile = true;
+    board.applyMove(mcts.getAction(board));
+    auto stats = mcts.m_stats;
+    EXPECT_EQ(stats.calls[SearchStats::Select], mcts.m_iterations);
+    EXPECT_EQ(stats.calls[SearchStats::BackPropogate], mcts.m_iterations);
+    EXPECT_LE(stats.calls[SearchStats::Simulate], mcts.m_iterations);
+    EXPECT_GT(stats.time[SearchStats::Simulate].count(), 0);
+    EXPECT_EQ(stats.nodes, stats.children) << "a fresh tree should allocate every registered child";
+    EXPECT_GT(stats.branching(), 1.0);
+    EXPECT_GE(stats.maxDepth, 1);
+    EXPECT_LE(stats.averageDepth(), stats.maxDepth);
+    // 选择阶段每落一子，都经由CachedApplyMove
+    EXPECT_EQ(stats.cacheHits + stats.cacheMisses, stats.depth);
+    EXPECT_GE(stats.applies, stats.cacheMisses);
+    EXPECT_GT(stats.reverts, 0);
+    // 不计时的搜索只计数
+    mcts.c_profile = false;
+    board.applyMove(mcts.getAction(board));
+    EXPECT_EQ(mcts.m_stats.calls[SearchStats::Select], mcts.m_iterations);
+    for (auto time : mcts.m_stats.time) {
+        EXPECT_EQ(time.count(), 0);
+    }
+}
+
+TEST(TimeManagerTest, AdaptiveBudget) {
+    using std::chrono::milliseconds;
+    TimeManager timer(milliseconds(1000), milliseconds(10), milliseconds(200), 20);
+    // 基准时长为剩余时长的1/20，延长至多一倍
+    timer.start();
+    EXPECT_EQ(timer.m_budget, milliseconds(50));
+    EXPECT_FALSE(timer.shouldStop(100, 100000, 0)) << "stopped before the minimum per-move time";
+    std::this_thread::sleep_for(milliseconds(15));
+    EXPECT_FALSE(timer.shouldStop(100, 60, 40)); // 领先不多，仍可追上
+    EXPECT_TRUE(timer.shouldStop(100, 100000, 0)); // 剩余时间内无法追上
+    EXPECT_TRUE(timer.m_stoppedEarly);
+    timer.finish();
+    EXPECT_LT(timer.m_remaining, milliseconds(1000));
+    EXPECT_EQ(timer.m_remaining + timer.m_spent, milliseconds(1000));
+    // 到达基准时长时两者接近，延长一次
+    timer.start();
+    std::this_thread::sleep_for(timer.m_budget + milliseconds(5));
+    EXPECT_FALSE(timer.shouldStop(1000, 500, 450));
+    EXPECT_TRUE(timer.m_extended);
+    std::this_thread::sleep_for(timer.m_budget + milliseconds(5));
+    EXPECT_TRUE(timer.shouldStop(1000, 500, 450));
+    timer.finish();
+    timer.reset();
+    EXPECT_EQ(timer.m_remaining, milliseconds(1000));
+}
+
+TEST(MCTSTest, TimeManagedSearch) {
+    using std::chrono::milliseconds;
+    for (size_t threads : { 1, 2 }) {
+        Board board;
+        MCTS mcts(C_DURATION, -1, Player::White, std::make_shared<RandomPolicy>(), threads);
+        mcts.m_timer = std::make_shared<TimeManager>(milliseconds(2000), milliseconds(10), milliseconds(100));
+        for (int i = 0; i < 3; ++i) {
+            board.applyMove(mcts.getAction(board));
+            EXPECT_GT(mcts.m_iterations, 0);
+            EXPECT_LE(mcts.m_timer->m_spent, milliseconds(200)) << "search ignored the per-move limit";
+            ASSERT_EQ(mcts.m_size, CountNodes(mcts.m_root.get()));
+        }
+        EXPECT_LT(mcts.m_timer->m_remaining, milliseconds(2000));
+        mcts.reset();
+        EXPECT_EQ(mcts.m_timer->m_remaining, milliseconds(2000));
+    }
+}
+
+TEST(VectorizedTest, ArgMaxPUCBMatchesScalar) {
+    std::mt19937 engine(2018);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f), prob(0.0f, 1.0f);
+    std::uniform_int_distribution<std::uint32_t> visit(0, 50);
+    for (std::size_t size = 1; size <= 40; ++size) {
+        std::vector<float> Q(size), P(size);
+        std::vector<std::uint32_t> n(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            Q[i] = value(engine), P[i] = prob(engine), n[i] = visit(engine);
+        }
+        Q[size / 2] = Q[size - 1], P[size / 2] = P[size - 1], n[size / 2] = n[size - 1]; // 构造平局
+        const float c_sqrtN = 5.0f * std::sqrt(1000.0f);
+        std::size_t expected = 0;
+        float max_score = -INFINITY;
+        for (std::size_t i = 0; i < size; ++i) {
+            auto score = Q[i] + c_sqrtN * P[i] / (n[i] + 1.0f);
+            if (score > max_score) {
+                max_score = score, expected = i;
+            }
+        }
+        ASSERT_EQ(Algorithms::Vectorized::ArgMaxPUCB(Q.data(), P.data(), n.data(), size, c_sqrtN), expected) << "size: " << size;
+    }
+}
+
+TEST(VectorizedTest, ArgMaxPUCBThreshold) {
+    std::vector<float> Q(9, -1.0f), P(9, 0.0f);
+    std::vector<std::uint32_t> n(9, 0);
+    EXPECT_EQ(Algorithms::Vectorized::ArgMaxPUCB(Q.data(), P.data(), n.data(), 9, 1.0f, -1.0f), 0);
+    Q[7] = -0.5f;
+    EXPECT_EQ(Algorithms::Vectorized::ArgMaxPUCB(Q.data(), P.data(), n.data(), 9, 1.0f, -1.0f), 7);
+}
+
+TEST(MCTSTest, ParallelSearch) {
+    Board board;
+    MCTS mcts(size_t(C_ITERATIONS / 20), -1, Player::White, std::make_shared<RandomPolicy>(), 4);
+    for (int i = 0; i < 3; ++i) {
+        board.applyMove(mcts.getAction(board));
+        ASSERT_EQ(mcts.m_iterations, C_ITERATIONS / 20);
+        ASSERT_EQ(mcts.m_size, CountNodes(mcts.m_root.get())) << "pool size differs from tree size";
+        CheckChildStats(mcts.m_root.get());
+    }
+}
+
+TEST(MCTSTest, ParallelPoliciesAreIndependent) {
+    Board board;
+    auto policy = std::make_shared<TraditionalPolicy>();
+    MCTS mcts(size_t(C_ITERATIONS / 100), -1, Player::White, policy, 2);
+    ASSERT_EQ(mcts.m_workers.size(), 2);
+    EXPECT_NE(mcts.m_workers[0], mcts.m_workers[1]);
+    board.applyMove(mcts.getAction(board));
+    CheckChildStats(mcts.m_root.get());
+    EXPECT_EQ(board.m_moveRecord.size(), 1) << "parallel search changed board state";
+}
+
+TEST(MCTSTest, ClonesKeepSettings) {
+    // 树并行、集成与自对弈均在副本上搜索，副本应保留原型的共通配置
+    std::shared_ptr<Policy> prototypes[] = {
+        std::make_shared<TraditionalPolicy>(), std::make_shared<RandomPolicy>(), std::make_shared<PoolRAVEPolicy>()
+    };
+    for (auto& prototype : prototypes) {
+        prototype->c_widening = 1.5;
+        prototype->c_batchSize = 3;
+        auto clone = prototype->clone();
+        ASSERT_NE(clone, nullptr);
+        EXPECT_EQ(clone->c_puct, prototype->c_puct);
+        EXPECT_EQ(clone->c_widening, 1.5);
+        EXPECT_EQ(clone->c_batchSize, 3);
+    }
+    auto traditional = std::make_shared<TraditionalPolicy>();
+    traditional->c_widening = 1.0;
+    MCTS mcts(size_t(C_ITERATIONS / 100), -1, Player::White, traditional, 2);
+    for (auto& worker : mcts.m_workers) {
+        EXPECT_EQ(worker->c_widening, 1.0);
+    }
+}
+
+TEST(MCTSTest, ParallelRequiresClone) {
+    EXPECT_THROW(MCTS(size_t(1), -1, Player::White, std::make_shared<Policy>(), 2), std::invalid_argument);
+}
+
+TEST(EnsembleMCTSTest, MergedSearch) {
+    Board board;
+    EnsembleMCTS mcts(size_t(C_ITERATIONS / 50), -1, Player::White, std::make_shared<RandomPolicy>(), 3);
+    ASSERT_EQ(mcts.m_trees.size(), 3);
+    EXPECT_NE(mcts.m_trees[0]->m_policy, mcts.m_trees[1]->m_policy) << "trees should not share policy";
+    for (int i = 0; i < 2; ++i) {
+        auto [state_value, action_probs] = mcts.evalState(board);
+        EXPECT_NEAR(action_probs.sum(), 1.0f, 1e-3);
+        EXPECT_EQ(mcts.m_iterations, 3 * (C_ITERATIONS / 50));
+        auto [child_visits, child_values, root_value] = mcts.mergeRoots();
+        size_t total_visits = 0;
+        for (auto&& tree : mcts.m_trees) {
+            for (auto child : tree->m_root->children) {
+                total_visits += child->node_visits;
+            }
+        }
+        EXPECT_EQ(child_visits.sum(), total_visits);
+        board.applyMove(mcts.getAction(board));
+        for (auto&& tree : mcts.m_trees) {
+            ASSERT_EQ(tree->m_root->position, board.m_moveRecord.back()) << "trees are not synced";
+        }
+    }
+}
+
+// 递归检查结点的访问次数不少于其子结点之和（虚拟损失未被撤销时将违反此条件）
+static void CheckVisits(const Node* node) {
+    size_t child_visits = 0;
+    for (auto child : node->children) {
+        child_visits += child->node_visits;
+        CheckVisits(child);
+    }
+    ASSERT_GE(node->node_visits, child_visits);
+}
+
+TEST(MCTSTest, BatchedEvaluation) {
+    size_t calls = 0, evaluated = 0;
+    auto policy = std::make_shared<Policy>(nullptr, nullptr, nullptr, nullptr, C_PUCT, 
+        [&](const std::vector<Board>& boards) {
+            ++calls, evaluated += boards.size();
+            std::vector<Policy::EvalResult> results;
+            for (auto board : boards) {
+                results.push_back(Algorithms::Default::Simulate(nullptr, board));
+            }
+            return results;
+        }, 8);
+    Board board;
+    MCTS mcts(size_t(800), -1, Player::White, policy);
+    mcts.evalState(board);
+    EXPECT_EQ(mcts.m_root->node_visits, 800);
+    EXPECT_LE(evaluated, 800);
+    EXPECT_LT(calls, 800 / 4) << "leaves are not batched";
+    ASSERT_EQ(mcts.m_size, CountNodes(mcts.m_root.get()));
+    CheckChildStats(mcts.m_root.get());
+    CheckVisits(mcts.m_root.get());
+}
@@ -0,0 +1,219 @@
+#include "pch.h"
+#include "lib/include/Network.h"
+#include "lib/include/SelfPlay.h"
+#include "lib/include/Mapping.h"
+#include "lib/include/Pattern.h"
+#include "lib/include/policies/AlphaZero.h"
+#include <cstdio>
+#include <fstream>
+
+using namespace Gomoku;
+using namespace Gomoku::Policies;
+
+using Layer = PolicyValueNetwork::Layer;
+using Activation = PolicyValueNetwork::Activation;
+using Precision = PolicyValueNetwork::Precision;
+
+static Layer RandomLayer(int kernel, int inputs, int outputs, Activation activation) {
+    const int size = std::max(kernel, 1);
+    return {
+        kernel, inputs, outputs, activation,
+        Eigen::MatrixXf::Random(outputs, inputs * size * size) * 0.2f, Eigen::VectorXf::Random(outputs) * 0.1f
+    };
+}
+
+// 与model_keras.py结构相同、通道数缩小的随机网络
+static PolicyValueNetwork RandomNetwork() {
+    PolicyValueNetwork network;
+    network.m_trunk = {
+        RandomLayer(3, Sample::Planes, 8, Activation::None),
+        RandomLayer(3, 8, 8, Activation::None)
+    };
+    network.m_valueHead = {
+        RandomLayer(1, 8, 2, Activation::ReLU),
+        RandomLayer(0, 2 * BOARD_SIZE, 16, Activation::ReLU),
+        RandomLayer(0, 16, 1, Activation::Tanh)
+    };
+    network.m_policyHead = {
+        RandomLayer(1, 8, 4, Activation::ReLU),
+        RandomLayer(0, 4 * BOARD_SIZE, BOARD_SIZE, Activation::Softmax)
+    };
+    return network;
+}
+
+static std::vector<Board> TestBoards() {
+    return {
+        Board(),
+        MakeBoard({ { 7, 7 }, { 8, 8 } }, { { 7, 8 } }),
+        MakeBoard({ { 0, 0 }, { WIDTH - 1, HEIGHT - 1 }, { 3, 6 } }, { { WIDTH - 1, 0 }, { 0, HEIGHT - 1 }, { 6, 3 } })
+    };
+}
+
+TEST(NetworkTest, ConvolutionLayout) {
+    // 3x3卷积只取当前玩家平面上方一格，价值头读出(4, 4)处的结果，策略头为恒等映射
+    PolicyValueNetwork network;
+    Layer conv = { 3, Sample::Planes, 1, Activation::None, Eigen::MatrixXf::Zero(1, Sample::Planes * 9), Eigen::VectorXf::Zero(1) };
+    conv.weights(0, 0 * 3 + 1) = 1; // (ky, kx) = (0, 1)，即平移(-1, 0)
+    Layer value = { 0, BOARD_SIZE, 1, Activation::None, Eigen::MatrixXf::Zero(1, BOARD_SIZE), Eigen::VectorXf::Zero(1) };
+    value.weights(0, int(Position(4, 4))) = 1;
+    Layer policy = { 0, BOARD_SIZE, BOARD_SIZE, Activation::Softmax, Eigen::MatrixXf::Identity(BOARD_SIZE, BOARD_SIZE) * 10, Eigen::VectorXf::Zero(BOARD_SIZE) };
+    network.m_trunk = { conv };
+    network.m_valueHead = { value };
+    network.m_policyHead = { policy };
+    network.validate();
+
+    auto board = MakeBoard({ { 4, 3 } }, { { 0, 0 } }); // 轮到黑棋
+    auto [state_value, probs] = network.evaluate(board);
+    EXPECT_FLOAT_EQ(state_value, 1);
+    EXPECT_EQ(probs.size(), BOARD_SIZE);
+    EXPECT_NEAR(probs.sum(), 1.0f, 1e-4f);
+    Eigen::Index max_index;
+    probs.maxCoeff(&max_index);
+    EXPECT_EQ(max_index, Position(4, 4));
+
+    // 改为平移(0, 1)：行末越界处按0填充，不会读到下一行的行首
+    conv.weights.setZero();
+    conv.weights(0, 1 * 3 + 2) = 1;
+    network.m_trunk = { conv };
+    board = MakeBoard({ { 0, 4 }, { WIDTH - 1, 7 } }, { { 0, 0 }, { 1, 1 } });
+    for (auto [target, expected] : { std::pair{ Position(WIDTH - 1, 3), 0.0f }, std::pair{ Position(WIDTH - 2, 7), 1.0f } }) {
+        value.weights.setZero();
+        value.weights(0, int(target)) = 1;
+        network.m_valueHead = { value };
+        EXPECT_FLOAT_EQ(std::get<0>(network.evaluate(board)), expected) << "target " << target;
+    }
+}
+
+TEST(NetworkTest, IncrementalFeaturePlanes) {
+    // BoardMap增量维护的特征平面在落子与悔棋后均与完整编码一致
+    auto encoded = [](const Board& board) {
+        std::array<std::uint8_t, Sample::Planes * BOARD_SIZE> states;
+        Sample::EncodeStates(board, states.data());
+        return states;
+    };
+    auto copied = [](const FeaturePlanes& features) {
+        std::array<std::uint8_t, Sample::Planes * BOARD_SIZE> states;
+        features.copyTo(states.data());
+        return states;
+    };
+    BoardMap map;
+    ASSERT_EQ(copied(map.m_features), encoded(*map.m_board));
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 20; ++i) {
+            map.applyMove(map.m_board->getRandomMove());
+            ASSERT_EQ(copied(map.m_features), encoded(*map.m_board)) << "apply " << i;
+            ASSERT_EQ(copied(FeaturePlanes(*map.m_board)), encoded(*map.m_board));
+        }
+        for (int i = 0; i < 12; ++i) {
+            map.revertMove();
+            ASSERT_EQ(copied(map.m_features), encoded(*map.m_board)) << "revert " << i;
+        }
+    }
+
+    // 评估器的快照一并保存特征平面
+    Evaluator ev;
+    Evaluator::Snapshot snapshot;
+    ev.applyMove({ 7, 7 });
+    ev.save(snapshot);
+    ev.applyMove({ 8, 8 });
+    ev.applyMove({ 6, 6 });
+    ev.restore(snapshot);
+    EXPECT_EQ(copied(ev.m_boardMap.m_features), encoded(ev.board()));
+}
+
+TEST(NetworkTest, BatchedEvaluation) {
+    auto network = RandomNetwork();
+    auto boards = TestBoards();
+    auto results = network.evaluate(boards);
+    ASSERT_EQ(results.size(), boards.size());
+    for (size_t i = 0; i < boards.size(); ++i) {
+        auto [value, probs] = network.evaluate(boards[i]);
+        EXPECT_NEAR(std::get<0>(results[i]), value, 1e-5f) << "board " << i;
+        EXPECT_TRUE(std::get<1>(results[i]).isApprox(probs, 1e-5f)) << "board " << i;
+        EXPECT_LE(std::abs(value), 1.0f);
+        EXPECT_NEAR(probs.sum(), 1.0f, 1e-4f);
+        EXPECT_GE(probs.minCoeff(), 0.0f);
+    }
+    EXPECT_TRUE(network.evaluate(std::vector<Board>()).empty());
+}
+
+TEST(NetworkTest, SaveAndLoad) {
+    const char* path = "network_unittest.weights";
+    auto network = RandomNetwork();
+    auto board = TestBoards()[2];
+    auto [value, probs] = network.evaluate(board);
+    std::streamoff sizes[3];
+    const std::pair<Precision, float> cases[] = { { Precision::Float32, 0 }, { Precision::Float16, 1e-2f }, { Precision::Int8, 5e-2f } };
+    for (auto [precision, tolerance] : cases) {
+        network.save(path, precision);
+        sizes[int(precision)] = std::ifstream(path, std::ios::binary | std::ios::ate).tellg();
+        PolicyValueNetwork loaded(path);
+        auto [loaded_value, loaded_probs] = loaded.evaluate(board);
+        EXPECT_NEAR(loaded_value, value, tolerance) << "precision " << int(precision);
+        EXPECT_LE((loaded_probs - probs).cwiseAbs().maxCoeff(), tolerance) << "precision " << int(precision);
+    }
+    EXPECT_LT(sizes[1], sizes[0]);
+    EXPECT_LT(sizes[2], sizes[1]);
+    std::remove(path);
+}
+
+TEST(NetworkTest, InvalidNetworks) {
+    EXPECT_THROW(PolicyValueNetwork("missing.weights"), std::runtime_error);
+    EXPECT_THROW(PolicyValueNetwork().validate(), std::invalid_argument);
+
+    auto network = RandomNetwork();
+    network.m_policyHead.back() = RandomLayer(0, 4 * BOARD_SIZE, 10, Activation::Softmax);
+    EXPECT_THROW(network.validate(), std::invalid_argument);
+    network = RandomNetwork();
+    network.m_trunk[1] = RandomLayer(3, 7, 8, Activation::None);
+    EXPECT_THROW(network.save("invalid_unittest.weights"), std::invalid_argument);
+
+    const char* path = "invalid_unittest.weights";
+    std::ofstream(path, std::ios::binary) << "not a network at all";
+    EXPECT_THROW(PolicyValueNetwork{ path }, std::runtime_error);
+    RandomNetwork().save(path, Precision::Int8);
+    { // 截断的权重
+        std::ifstream ifs(path, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        ifs.close();
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << content.substr(0, content.size() - 1);
+    }
+    EXPECT_THROW(PolicyValueNetwork{ path }, std::runtime_error);
+    std::remove(path);
+}
+
+TEST(NetworkTest, AlphaZeroSearch) {
+    auto network = std::make_shared<const PolicyValueNetwork>(RandomNetwork());
+    auto policy = std::make_shared<AlphaZeroPolicy>(network, C_PUCT, 4);
+    auto board = TestBoards()[1];
+    policy->prepare(board);
+    auto [value, probs] = policy->simulate(board);
+    EXPECT_FLOAT_EQ(value, std::get<0>(network->evaluate(board)));
+    EXPECT_NEAR(probs.sum(), 1.0f, 1e-4f);
+    for (auto move : board.m_moveRecord) {
+        EXPECT_EQ(probs[move], 0) << "occupied " << move;
+    }
+
+    MCTS mcts(100, board.m_moveRecord.back(), -board.m_curPlayer, policy);
+    EXPECT_TRUE(board.checkMove(mcts.getAction(board)));
+
+    // 启用缓存后，重复的搜索复用此前的网络评估
+    policy->m_cache = std::make_shared<EvaluationCache>();
+    for (int i = 0; i < 2; ++i) {
+        MCTS cached(100, board.m_moveRecord.back(), -board.m_curPlayer, policy);
+        EXPECT_TRUE(board.checkMove(cached.getAction(board)));
+    }
+    EXPECT_GT(policy->m_cache->stats().hits, 0);
+    EXPECT_EQ(policy->m_cache->size(), policy->m_cache->stats().stores);
+
+    // 各线程的副本共用同一个网络与缓存
+    auto clone = std::dynamic_pointer_cast<AlphaZeroPolicy>(policy->clone());
+    ASSERT_TRUE(clone);
+    EXPECT_EQ(clone->m_network, network);
+    EXPECT_EQ(clone->m_cache, policy->m_cache);
+    SelfPlay search(policy, 50, 2);
+    auto results = search.search(TestBoards());
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_TRUE(TestBoards()[i].checkMove(results[i].move)) << "board " << i;
+    }
+}
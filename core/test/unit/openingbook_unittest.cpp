@@ -0,0 +1,70 @@
+#include "pch.h"
+#include "lib/include/OpeningBook.h"
+#include "lib/include/policies/Random.h"
+#include <cstdio>
+#include <fstream>
+#include <set>
+
+using namespace Gomoku;
+using namespace Gomoku::Policies;
+
+static Board Transformed(const Board& board, int symmetry) {
+    Board transformed;
+    for (auto move : board.m_moveRecord) {
+        transformed.applyMove(BoardHash::Transform(move, symmetry));
+    }
+    return transformed;
+}
+
+TEST(OpeningBookTest, GenerateAndLookup) {
+    const char* path = "opening_unittest.book";
+    auto entries = OpeningBook::Generate(std::make_shared<RandomPolicy>(), 200, 3, 2);
+    std::set<std::uint64_t> keys;
+    for (auto& entry : entries) {
+        keys.insert(entry.key);
+        EXPECT_GT(entry.visits, 0);
+    }
+    EXPECT_GE(keys.size(), 2);
+    EXPECT_LE(keys.size(), 1 + 2 + 4);
+    OpeningBook::Write(path, entries);
+
+    OpeningBook book(path);
+    ASSERT_EQ(book.size(), entries.size());
+    // 沿库中的着法下至库外，每一步在8种对称的局面上给出等价的着法
+    Board board;
+    for (int ply = 0; ply < 3; ++ply) {
+        auto move = book.lookup(board);
+        ASSERT_NE(move, Position::npos) << "ply " << ply;
+        ASSERT_TRUE(board.checkMove(move));
+        Board next = board;
+        next.applyMove(move);
+        const auto expected = SymmetricHash(next).canonical();
+        for (int s = 1; s < SymmetricHash::Size; ++s) {
+            auto transformed = Transformed(board, s);
+            auto transformed_move = book.lookup(transformed);
+            ASSERT_TRUE(transformed.checkMove(transformed_move));
+            transformed.applyMove(transformed_move);
+            EXPECT_EQ(SymmetricHash(transformed).canonical(), expected) << "symmetry " << s;
+        }
+        board = next;
+    }
+    EXPECT_EQ(book.lookup(board), Position::npos);
+    std::remove(path);
+}
+
+TEST(OpeningBookTest, InvalidFiles) {
+    EXPECT_EQ(OpeningBook().lookup(Board()), Position::npos);
+    EXPECT_THROW(OpeningBook("missing.book"), std::runtime_error);
+
+    const char* path = "invalid_unittest.book";
+    std::ofstream(path, std::ios::binary) << "not an opening book at all";
+    EXPECT_THROW(OpeningBook{ path }, std::runtime_error);
+
+    OpeningBook::Write(path, {});
+    EXPECT_EQ(OpeningBook(path).size(), 0);
+    { // 截断的表项
+        std::ofstream(path, std::ios::binary | std::ios::app) << "partial";
+    }
+    EXPECT_THROW(OpeningBook{ path }, std::runtime_error);
+    std::remove(path);
+}
@@ -0,0 +1,44 @@
+#include "pch.h"
+#include "lib/src/utils/Persistence.h"
+#include "lib/include/Mapping.h"
+#include <cstdio>
+#include <set>
+#include <string>
+
+using namespace Gomoku;
+
+TEST(PersistenceTest, SaveAndLoad) {
+    // 在临时目录中读写，不依赖也不改动工作目录下的./data
+    const auto path = ::testing::TempDir() + "persistence_unittest.bin";
+    std::remove(path.c_str());
+    Persistence::SetPath(path);
+    ASSERT_EQ(Persistence::Path(), path);
+    EXPECT_TRUE(Persistence::Load("unittest/missing").empty());
+    const std::string binary("\0\1\2\3", 4);
+    Persistence::Save("unittest/binary", binary);
+    Persistence::Save("unittest/text", "persistence");
+    EXPECT_EQ(Persistence::Load("unittest/binary"), binary);
+    EXPECT_EQ(Persistence::Load("unittest/text"), "persistence");
+    auto view = Persistence::Load("unittest/binary");
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.data()) % 8, 0) << "values should be 8-byte aligned";
+
+    Persistence::Save("unittest/text", "overwritten");
+    EXPECT_EQ(Persistence::Load("unittest/text"), "overwritten");
+    EXPECT_EQ(Persistence::Load("unittest/binary"), binary);
+
+    // 改用其他路径后，不再读到临时存储中的值
+    Persistence::SetPath("./missing/persistence.bin");
+    EXPECT_TRUE(Persistence::Load("unittest/text").empty());
+    Persistence::SetPath(Persistence::DefaultPath);
+    std::remove(path.c_str());
+}
+
+TEST(PersistenceTest, DeterministicZobrist) {
+    // 键在编译期生成，不依赖任何文件
+    static_assert(BoardHash::Zorbrist[0][0] != BoardHash::Zorbrist[0][1], "zobrist keys are not constexpr");
+    std::set<std::uint64_t> keys;
+    for (auto& key : BoardHash::Zorbrist) {
+        keys.insert(key.begin(), key.end());
+    }
+    EXPECT_EQ(keys.size(), 3 * BOARD_SIZE);
+}
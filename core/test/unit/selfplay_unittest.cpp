@@ -0,0 +1,121 @@
+#include "pch.h"
+#include "lib/include/SelfPlay.h"
+#include "lib/include/policies/Random.h"
+#include "lib/include/policies/Traditional.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace Gomoku {
+inline bool operator==(const Sample& lhs, const Sample& rhs) {
+    return lhs.states == rhs.states && lhs.value == rhs.value && lhs.probs == rhs.probs;
+}
+}
+
+using namespace Gomoku;
+using namespace Gomoku::Policies;
+
+TEST(SelfPlayTest, SymmetricSamples) {
+    // 对称变换后的样本应与对称局面直接编码的样本一致
+    auto board = MakeBoard({ { 7, 7 }, { 8, 8 }, { 3, 6 } }, { { 6, 7 }, { 0, 1 } });
+    Eigen::VectorXf probs = Eigen::VectorXf::LinSpaced(BOARD_SIZE, 0, 1);
+    auto sample = Sample::Encode(board, probs);
+    sample.value = -1;
+    EXPECT_EQ(sample.states[3 * BOARD_SIZE + Position(3, 6)], 1); // 上一手
+    EXPECT_EQ(sample.states[4 * BOARD_SIZE + Position(0, 1)], 1);  // 上上手
+    EXPECT_EQ(sample.states[5 * BOARD_SIZE], 0); // 轮到白棋
+    EXPECT_EQ(sample.transformed(0), sample);
+    for (int s = 1; s < SymmetricHash::Size; ++s) {
+        Board transformed;
+        Eigen::VectorXf transformed_probs(BOARD_SIZE);
+        for (auto move : board.m_moveRecord) {
+            transformed.applyMove(BoardHash::Transform(move, s));
+        }
+        for (int i = 0; i < BOARD_SIZE; ++i) {
+            transformed_probs[BoardHash::Transform(i, s)] = probs[i];
+        }
+        auto expected = Sample::Encode(transformed, transformed_probs);
+        expected.value = -1;
+        EXPECT_EQ(sample.transformed(s), expected) << "symmetry " << s;
+        EXPECT_EQ(sample.transformed(s).transformed(BoardHash::Inverse(s)), sample);
+    }
+}
+
+TEST(SelfPlayTest, ParallelGamesToShard) {
+    const char* path = "selfplay_unittest.shard";
+    SelfPlay self_play(std::make_shared<RandomPolicy>(), 50, 2);
+    size_t games = 0;
+    {
+        ShardWriter writer(path);
+        self_play.play(3, [&](std::vector<Sample>& samples) {
+            ++games;
+            ASSERT_EQ(samples.size() % SymmetricHash::Size, 0);
+            for (auto& sample : samples) {
+                EXPECT_NEAR(Eigen::Map<const Eigen::VectorXf>(sample.probs.data(), BOARD_SIZE).sum(), 1.0f, 1e-3f);
+            }
+            // 每局首个样本为空棋盘，终局得分依轮次交替
+            EXPECT_EQ(samples[0].states[2 * BOARD_SIZE], 1);
+            const auto next = samples[SymmetricHash::Size].value;
+            EXPECT_EQ(samples[0].value, -next);
+            writer.write(samples);
+        });
+        EXPECT_EQ(games, 3);
+        EXPECT_GT(writer.size(), 0);
+    } // 析构时回填样本数
+
+    auto samples = ShardWriter::Read(path);
+    ASSERT_FALSE(samples.empty());
+    EXPECT_EQ(samples.size() % SymmetricHash::Size, 0);
+
+    self_play.c_augment = false;
+    self_play.c_workers = 1;
+    auto plain = self_play.play(1);
+    ASSERT_FALSE(plain.empty());
+    EXPECT_EQ(std::count(plain[0].states.begin(), plain[0].states.begin() + BOARD_SIZE, 1), 0);
+    std::remove(path);
+}
+
+TEST(SelfPlayTest, InvalidShards) {
+    EXPECT_THROW(ShardWriter::Read("missing.shard"), std::runtime_error);
+    EXPECT_THROW(SelfPlay(std::make_shared<Policy>(), 10, 2), std::invalid_argument); // 基类策略不支持clone()
+    EXPECT_THROW(SelfPlay(nullptr, 10, 0), std::invalid_argument);
+
+    const char* path = "invalid_unittest.shard";
+    std::ofstream(path, std::ios::binary) << "not a sample shard at all";
+    EXPECT_THROW(ShardWriter::Read(path), std::runtime_error);
+    {
+        ShardWriter writer(path);
+        writer.write(std::vector<Sample>(2));
+        writer.close();
+    }
+    EXPECT_EQ(ShardWriter::Read(path).size(), 2);
+    { // 表头声明的样本数多于文件内容
+        std::fstream fs(path, std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(16);
+        const std::uint64_t count = 3;
+        fs.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    EXPECT_THROW(ShardWriter::Read(path), std::runtime_error);
+    std::remove(path);
+}
+
+TEST(SelfPlayTest, SearchMany) {
+    // 各局面独立搜索，结果与输入一一对应
+    std::vector<Board> boards(4);
+    boards[1] = MakeBoard(
+        { { 3, 5 }, { 4, 5 }, { 5, 5 }, { 6, 2 }, { 6, 3 }, { 6, 4 } },
+        { { 2, 5 }, { 6, 1 }, { 0, 0 }, { WIDTH - 1, 0 }, { 0, HEIGHT - 1 }, { WIDTH - 1, HEIGHT - 1 } }
+    );
+    boards[2] = MakeBoard({ { 7, 7 } }, { { 7, 8 } });
+    boards[3] = MakeBoard({ { 0, 0 }, { 1, 0 }, { 2, 0 }, { 3, 0 }, { 4, 0 } }, { { 0, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 } });
+    SelfPlay search(std::make_shared<TraditionalPolicy>(), 200, 3);
+    auto results = search.search(boards);
+    ASSERT_EQ(results.size(), boards.size());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(boards[i].checkMove(results[i].move)) << "board " << i;
+        EXPECT_NEAR(results[i].probs.sum(), 1.0f, 1e-3f);
+    }
+    EXPECT_EQ(results[1].move, Position(6, 5)); // 双四，由VCF直接证明
+    EXPECT_EQ(results[3].move, Position::npos);  // 已结束
+    EXPECT_EQ(boards[2].m_moveRecord.size(), 2); // 输入的局面不变
+}
@@ -0,0 +1,300 @@
+#include "pch.h"
+#include "lib/include/Transposition.h"
+#include "lib/include/Mapping.h"
+#include "lib/include/policies/Traditional.h"
+#include "lib/include/policies/Random.h"
+#include <set>
+#include <thread>
+
+using namespace Gomoku;
+using namespace Gomoku::Policies;
+
+TEST(TranspositionTableTest, StoreAndProbe) {
+    TranspositionTable table(1000);
+    ASSERT_EQ(table.capacity(), 1024) << "capacity is not rounded up to power of 2";
+    Eigen::VectorXf probs = Eigen::VectorXf::LinSpaced(BOARD_SIZE, 0.0f, 1.0f);
+    EXPECT_FALSE(table.probe(42));
+    table.store(42, { 0.5f, probs });
+    auto result = table.probe(42);
+    ASSERT_TRUE(result);
+    auto& [value, cached_probs] = *result;
+    EXPECT_EQ(value, 0.5f);
+    EXPECT_EQ(cached_probs, probs);
+    EXPECT_FALSE(table.probe(42 + 1024)) << "colliding key should not hit";
+    table.store(42 + 1024, { -0.5f, probs }); // 覆盖同一表项
+    EXPECT_FALSE(table.probe(42));
+    auto stats = table.stats();
+    EXPECT_EQ(stats.probes, 4);
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.stores, 2);
+    EXPECT_EQ(stats.overwrites, 1);
+    EXPECT_DOUBLE_EQ(table.hitRate(), 0.25);
+    table.clear();
+    EXPECT_FALSE(table.probe(42 + 1024));
+}
+
+TEST(TranspositionTableTest, HashMatchesBoardMap) {
+    Board board;
+    BoardMap map;
+    uint64_t hash = TranspositionTable::Hash(board);
+    ASSERT_EQ(hash, map.m_hash);
+    for (Position move : { Position{ 7, 7 }, Position{ 7, 8 }, Position{ 8, 8 }, Position{ 6, 6 } }) {
+        hash = TranspositionTable::HashMove(hash, move, board.m_curPlayer);
+        board.applyMove(move);
+        map.applyMove(move);
+        ASSERT_EQ(TranspositionTable::Hash(board), map.m_hash);
+        ASSERT_EQ(hash, map.m_hash) << "incremental hash differs from full hash";
+    }
+    // 不同的落子顺序到达同一局面
+    Board transposed;
+    for (Position move : { Position{ 8, 8 }, Position{ 6, 6 }, Position{ 7, 7 }, Position{ 7, 8 } }) {
+        transposed.applyMove(move);
+    }
+    EXPECT_EQ(TranspositionTable::Hash(transposed), hash);
+}
+
+TEST(TranspositionTableTest, CachedSearch) {
+    Board board;
+    MCTS mcts(size_t(1000), -1, Player::White, std::make_shared<TraditionalPolicy>());
+    mcts.m_table = std::make_shared<TranspositionTable>();
+    board.applyMove(mcts.getAction(board));
+    board.applyMove(mcts.getAction(board));
+    auto stats = mcts.m_table->stats();
+    EXPECT_GT(stats.hits, 0) << "no transposition found during search";
+    EXPECT_EQ(stats.stores, stats.probes - stats.hits) << "every miss should be evaluated and stored";
+}
+
+TEST(TranspositionTableTest, SharedByParallelSearch) {
+    Board board;
+    auto table = std::make_shared<TranspositionTable>();
+    MCTS mcts(size_t(500), -1, Player::White, std::make_shared<TraditionalPolicy>(), 2);
+    mcts.m_table = table;
+    board.applyMove(mcts.getAction(board));
+    EXPECT_GT(table->stats().stores, 0);
+    EXPECT_EQ(board.m_moveRecord.size(), 1) << "parallel search changed board state";
+}
+
+TEST(TranspositionTableTest, SymmetryTransforms) {
+    for (int s = 0; s < SymmetricHash::Size; ++s) {
+        std::set<int> images;
+        for (int i = 0; i < BOARD_SIZE; ++i) {
+            auto image = BoardHash::Transform(i, s);
+            ASSERT_TRUE(image >= 0 && image < BOARD_SIZE);
+            ASSERT_EQ(BoardHash::Transform(image, BoardHash::Inverse(s)), Position(i)) << "symmetry " << s;
+            images.insert(image);
+        }
+        EXPECT_EQ(images.size(), BOARD_SIZE) << "symmetry " << s << " is not a permutation";
+    }
+    std::set<int> corners;
+    for (int s = 0; s < SymmetricHash::Size; ++s) {
+        corners.insert(BoardHash::Transform({ 1, 2 }, s));
+    }
+    EXPECT_EQ(corners.size(), SymmetricHash::Size) << "symmetries are not distinct";
+}
+
+TEST(TranspositionTableTest, SymmetricHash) {
+    const std::vector<Position> moves = { { 7, 7 }, { 7, 8 }, { 8, 8 }, { 6, 6 }, { 2, 3 } };
+    BoardMap map;
+    ASSERT_EQ(map.m_symmetry, SymmetricHash());
+    for (auto move : moves) {
+        map.applyMove(move);
+    }
+    EXPECT_EQ(map.m_symmetry.hashes[0], map.m_hash);
+    EXPECT_EQ(SymmetricHash(*map.m_board), map.m_symmetry) << "incremental hashes differ from full hashes";
+    for (int s = 0; s < SymmetricHash::Size; ++s) {
+        Board transformed;
+        for (auto move : moves) {
+            transformed.applyMove(BoardHash::Transform(move, s));
+        }
+        SymmetricHash hash(transformed);
+        EXPECT_EQ(hash.hashes[0], map.m_symmetry.hashes[s]);
+        EXPECT_EQ(hash.canonical(), map.m_symmetry.canonical());
+        // 双方经各自的规范变换得到同一局面
+        EXPECT_EQ(BoardHash::Transform(BoardHash::Transform(moves[0], s), hash.symmetry()),
+                  BoardHash::Transform(moves[0], map.m_symmetry.symmetry()));
+    }
+    map.revertMove(moves.size());
+    EXPECT_EQ(map.m_symmetry, SymmetricHash());
+}
+
+TEST(TranspositionTableTest, SymmetricProbe) {
+    const std::vector<Position> moves = { { 7, 7 }, { 8, 7 }, { 8, 8 }, { 3, 4 } };
+    Board board;
+    for (auto move : moves) {
+        board.applyMove(move);
+    }
+    Eigen::VectorXf probs = Eigen::VectorXf::LinSpaced(BOARD_SIZE, 0.0f, 1.0f);
+    TranspositionTable plain(1024), symmetric(1024, true);
+    plain.store(SymmetricHash(board), { 0.5f, probs });
+    symmetric.store(SymmetricHash(board), { 0.5f, probs });
+    for (int s = 1; s < SymmetricHash::Size; ++s) {
+        Board transformed;
+        for (auto move : moves) {
+            transformed.applyMove(BoardHash::Transform(move, s));
+        }
+        EXPECT_FALSE(plain.probe(SymmetricHash(transformed)));
+        auto result = symmetric.probe(SymmetricHash(transformed));
+        ASSERT_TRUE(result) << "symmetry " << s;
+        auto& [value, cached_probs] = *result;
+        EXPECT_EQ(value, 0.5f);
+        for (int i = 0; i < BOARD_SIZE; ++i) { // 概率随局面一同变换
+            ASSERT_EQ(cached_probs[BoardHash::Transform(i, s)], probs[i]);
+        }
+    }
+    auto result = symmetric.probe(SymmetricHash(board));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<1>(*result), probs);
+}
+
+// 在空棋盘上依次落下moves得到的局面
+static Board Played(const std::vector<Position>& moves) {
+    Board board;
+    for (auto move : moves) {
+        board.applyMove(move);
+    }
+    return board;
+}
+
+// 只在n个位置上有先验的评估结果
+static Policy::EvalResult SparseResult(float value, int n) {
+    Eigen::VectorXf probs = Eigen::VectorXf::Zero(BOARD_SIZE);
+    probs.head(n).setConstant(1.0f / n);
+    return { value, probs };
+}
+
+TEST(EvaluationCacheTest, LeastRecentlyUsedEviction) {
+    // 单个分片，恰好容纳3个含4个先验的表项
+    EvaluationCache cache(3 * EvaluationCache::EntrySize(4), false, 1);
+    std::vector<Board> boards;
+    for (int i = 0; i < 4; ++i) {
+        boards.push_back(Played({ Position(i, 0) }));
+    }
+    for (int i = 0; i < 3; ++i) {
+        cache.store(boards[i], SparseResult(0.1f * i, 4));
+    }
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_EQ(cache.memory(), 3 * EvaluationCache::EntrySize(4));
+    ASSERT_TRUE(cache.probe(boards[0])); // 令最早写入的局面成为最近使用
+    cache.store(boards[3], SparseResult(0.3f, 4));
+    EXPECT_FALSE(cache.probe(boards[1])) << "the least recently used entry should be evicted";
+    for (int i : { 0, 2, 3 }) {
+        auto result = cache.probe(boards[i]);
+        ASSERT_TRUE(result) << "board " << i;
+        EXPECT_FLOAT_EQ(std::get<0>(*result), 0.1f * i);
+        EXPECT_EQ(std::get<1>(*result), std::get<1>(SparseResult(0, 4)));
+    }
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.probes, 5);
+    EXPECT_EQ(stats.hits, 4);
+    EXPECT_EQ(stats.stores, 4);
+    EXPECT_EQ(stats.evictions, 1);
+
+    // 覆盖写入不重复计入占用，超出上限的表项不写入
+    cache.store(boards[0], SparseResult(0.5f, 4));
+    EXPECT_EQ(cache.memory(), 3 * EvaluationCache::EntrySize(4));
+    cache.store(Board(), SparseResult(0, BOARD_SIZE));
+    EXPECT_FALSE(cache.probe(Board()));
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.stats().probes, 0);
+}
+
+TEST(EvaluationCacheTest, SymmetricEntries) {
+    const std::vector<Position> moves = { { 7, 7 }, { 8, 7 }, { 3, 4 } };
+    auto board = Played(moves);
+    Eigen::VectorXf probs = Eigen::VectorXf::Zero(BOARD_SIZE);
+    probs[Position(1, 2)] = 0.75f;
+    probs[Position(5, 8)] = 0.25f;
+    EvaluationCache cache;
+    cache.store(board, { -0.5f, probs });
+    for (int s = 1; s < SymmetricHash::Size; ++s) {
+        std::vector<Position> transformed;
+        for (auto move : moves) {
+            transformed.push_back(BoardHash::Transform(move, s));
+        }
+        auto result = cache.probe(Played(transformed));
+        ASSERT_TRUE(result) << "symmetry " << s;
+        auto& [value, cached_probs] = *result;
+        EXPECT_EQ(value, -0.5f);
+        for (int i = 0; i < BOARD_SIZE; ++i) {
+            ASSERT_EQ(cached_probs[BoardHash::Transform(i, s)], probs[i]) << "symmetry " << s;
+        }
+    }
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(EvaluationCacheTest, RecentMovesInKey) {
+    // 网络的输入含最近两手：棋子相同而最近两手不同的局面不共用表项，更早的次序则无关
+    const Position a(7, 7), b(8, 7), c(3, 4), d(6, 2), e(5, 5), f(2, 8);
+    EvaluationCache cache;
+    cache.store(Played({ a, b, c, d, e, f }), SparseResult(0.5f, 4));
+    EXPECT_TRUE(cache.probe(Played({ c, d, a, b, e, f }))) << "only earlier moves differ";
+    EXPECT_FALSE(cache.probe(Played({ e, b, c, d, a, f }))) << "second last move differs";
+    EXPECT_FALSE(cache.probe(Played({ a, f, c, d, e, b }))) << "last move differs";
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(EvaluationCacheTest, CachedEvaluation) {
+    auto cache = std::make_shared<EvaluationCache>();
+    size_t evaluations = 0;
+    auto simulate = EvaluationCache::Cached(cache, [&](Board& board) {
+        ++evaluations;
+        return SparseResult(float(board.m_moveRecord.size()), 2);
+    });
+    auto board = Played({ { 7, 7 } });
+    EXPECT_EQ(std::get<0>(simulate(board)), 1);
+    EXPECT_EQ(std::get<0>(simulate(board)), 1);
+    EXPECT_EQ(evaluations, 1);
+
+    size_t evaluated = 0;
+    auto simulate_batch = EvaluationCache::Cached(cache, [&](const std::vector<Board>& boards) {
+        evaluated += boards.size();
+        std::vector<Policy::EvalResult> results;
+        for (auto& board : boards) {
+            results.push_back(SparseResult(float(board.m_moveRecord.size()), 2));
+        }
+        return results;
+    });
+    // 局面(7, 7)已在缓存中，只有两个新局面送去评估
+    std::vector<Board> boards = { Played({ { 0, 0 }, { 1, 1 } }), Played({ { 7, 7 } }), Played({ { 3, 3 }, { 4, 4 }, { 5, 5 } }) };
+    auto results = simulate_batch(boards);
+    ASSERT_EQ(results.size(), boards.size());
+    for (size_t i = 0; i < boards.size(); ++i) {
+        EXPECT_EQ(std::get<0>(results[i]), boards[i].m_moveRecord.size());
+    }
+    EXPECT_EQ(evaluated, 2);
+    simulate_batch(boards);
+    EXPECT_EQ(evaluated, 2);
+    EXPECT_EQ(cache->stats().hits, 1 + 1 + 3);
+}
+
+TEST(EvaluationCacheTest, SharedByThreads) {
+    // 4个线程两两读写同一批局面，分片少且容量不足，读写与逐出交错进行
+    EvaluationCache cache(200 * EvaluationCache::EntrySize(8), true, 2);
+    std::vector<Board> boards;
+    for (int i = 0; i < 300; ++i) {
+        boards.push_back(Played({ Position(i % BOARD_SIZE), Position((i * 7 + 1) % BOARD_SIZE) }));
+    }
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int round = 0; round < 3; ++round) {
+                for (size_t i = t % 2; i < boards.size(); i += 2) {
+                    if (auto result = cache.probe(boards[i])) {
+                        ASSERT_EQ(std::get<1>(*result).sum(), 1.0f);
+                    } else {
+                        cache.store(boards[i], SparseResult(0, 8));
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.probes, 4 * 3 * 150);
+    EXPECT_GT(stats.hits, 0);
+    EXPECT_LE(cache.memory(), cache.c_memory);
+    EXPECT_EQ(cache.size() * EvaluationCache::EntrySize(8), cache.memory());
+}
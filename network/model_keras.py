@@ -12,6 +12,7 @@ from keras.regularizers import l2
 from keras import backend as K
 import numpy as np
 import os
+import struct
 
 
 def ConvBlock(
@@ -108,6 +109,13 @@ class PolicyValueNetwork:
         # format to (float, np.array((255,1),dtype=float)) structure
         return vp[0][0][0], vp[1][0]
 
+    def eval_batch(self, states):
+        """
+        Evaluate a batch of board states with one forward pass.
+        """
+        vp = self.model.predict_on_batch(Board.encode_batch(states))
+        return [(vp[0][i][0], vp[1][i]) for i in range(len(states))]
+
     def train_step(self, optimizer):
         """
         One Network Tranning step.
@@ -128,3 +136,65 @@ class PolicyValueNetwork:
         base_path = "{}/keras".format(TRAINING_CONFIG["model_path"])
         if os.path.exists("{}/{}.h5".format(base_path, filename)):
             self.model.load_weights("{}/{}.h5".format(base_path, filename))
+
+    def export_native(self, path, precision="float32"):
+        """
+        Export the weights for the native PolicyValueNetwork in core/lib/include/Network.h.
+        Batch normalization is folded into the preceding conv layer,
+        precision is one of "float32", "float16" and "int8".
+        """
+        precision_id = NATIVE_PRECISIONS.index(precision)
+        parts = [
+            _native_layers(self.model.get_layer("policy_head").layers[0]),
+            _native_layers(self.model.get_layer("value_head")),
+            _native_layers(self.model.get_layer("policy_head"))
+        ]
+        with open(path, "wb") as f:
+            f.write(struct.pack("<4sIII", b"GMNN", 1, Game["width"], sum(map(len, parts))))
+            for part, layers in enumerate(parts):
+                for kernel, weights, bias, activation in layers:
+                    outputs = weights.shape[0]
+                    f.write(struct.pack(
+                        "<BBBBII", part, NATIVE_ACTIVATIONS.index(activation), precision_id,
+                        kernel, weights.shape[1] // max(kernel, 1) ** 2, outputs
+                    ))
+                    if precision == "int8":
+                        # symmetric quantization with one scale per output channel
+                        scales = np.abs(weights).max(axis=1) / 127
+                        safe_scales = np.where(scales > 0, scales, 1)[:, np.newaxis]
+                        f.write(scales.astype("<f4").tobytes())
+                        f.write(np.round(weights / safe_scales).astype(np.int8).tobytes())
+                    else:
+                        f.write(weights.astype("<f4" if precision == "float32" else "<f2").tobytes())
+                    f.write(bias.astype("<f4").tobytes())
+
+
+NATIVE_ACTIVATIONS = ["linear", "relu", "tanh", "softmax"]
+NATIVE_PRECISIONS = ["float32", "float16", "int8"]
+
+
+def _native_layers(sequential):
+    """
+    Flatten a head into [kernel, weights, bias, activation] records,
+    dense layers have kernel 0 and the shared net is skipped.
+    Weights are (outputs, inputs * kernel * kernel) ordered by (input, y, x).
+    """
+    layers = []
+    for layer in sequential.layers:
+        if isinstance(layer, Conv2D):
+            weights, bias = layer.get_weights()  # (ky, kx, inputs, outputs)
+            layers.append([
+                weights.shape[0], weights.transpose(3, 2, 0, 1).reshape(weights.shape[3], -1),
+                bias, layer.activation.__name__
+            ])
+        elif isinstance(layer, Dense):
+            weights, bias = layer.get_weights()  # (inputs, outputs)
+            layers.append([0, weights.T, bias, layer.activation.__name__])
+        elif isinstance(layer, BatchNormalization):
+            gamma, beta, mean, variance = layer.get_weights()
+            scale = gamma / np.sqrt(variance + layer.epsilon)
+            layers[-1][1] = layers[-1][1] * scale[:, np.newaxis]
+            layers[-1][2] = (layers[-1][2] - mean) * scale + beta
+        elif isinstance(layer, Activation):
+            layers[-1][3] = layer.activation.__name__
+    return layers
@@ -145,6 +145,17 @@ class PolicyValueNetwork:
         )
         return value[0], probs[0]
 
+    def eval_batch(self, states):
+        """
+        Evaluate a batch of board states with one forward pass.
+        """
+        self._lazy_initialize()
+        values, probs = self.session.run(
+            [self.value_output, self.policy_output],
+            feed_dict={self.inputs: Board.encode_batch(states)}
+        )
+        return [(values[i], probs[i]) for i in range(len(states))]
+
     def save_model(self, model_name):
         self.saver.save(self.session, self._parse_path(model_name))
 